@@ -0,0 +1,340 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    ===== 무방향 그래프 연결성 분석 =====
+
+    [구현 기능]
+    1) 연결 요소 (Connected Components) : union-find
+    2) 단절선 (Bridge) / 단절점 (Articulation Point) : 반복형 Tarjan
+
+    [그래프 표현]
+    - 10장.cpp 와 같은 입력을 받아 인접 리스트 대신 배열 형태(CSR)로 저장
+        정점 v의 이웃 : adj[offset[v]] ~ adj[offset[v + 1] - 1]
+        eid[k]       : adj[k] 가 어느 입력 간선인지 (간선 번호)
+    - 간선 번호가 있어야 같은 두 정점 사이의 중복 간선을
+      "부모로 돌아가는 간선"과 구분할 수 있음
+
+    [복잡도]
+    - 모두 O(V + E), 재귀 없이 명시적 스택을 쓰므로
+      정점이 백만 개 이상인 긴 경로 그래프도 호출 스택이 넘치지 않음
+*/
+
+#define FALSE 0
+#define TRUE 1
+
+/* ===== 배열 형태의 무방향 그래프 ===== */
+typedef struct Graph {
+    int n;              // 정점 수
+    int m;              // 입력 간선 수
+    int* offset;        // 길이 n + 1
+    int* adj;           // 이웃 정점, 길이 2m
+    int* eid;           // adj 와 같은 위치의 간선 번호, 길이 2m
+    int* eu;            // 간선 번호 → 양 끝 정점
+    int* ev;
+} Graph;
+
+void* xmalloc(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    return p;
+}
+
+/* 간선 (u, v) 추가, 배열이 차면 2배로 확장 */
+void add_edge(Graph* g, int u, int v, int* capacity) {
+    if (g->m == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 1024;
+        g->eu = (int*)realloc(g->eu, sizeof(int) * *capacity);
+        g->ev = (int*)realloc(g->ev, sizeof(int) * *capacity);
+        if (!g->eu || !g->ev) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+    }
+    g->eu[g->m] = u;
+    g->ev[g->m] = v;
+    g->m++;
+}
+
+/*
+    ===== build_graph =====
+    - 차수를 세어 누적합으로 offset 을 만든 뒤 간선을 배치 (counting sort)
+    - 10장.cpp 의 인접 리스트와 같은 이웃 순서가 되도록 뒤에서부터 배치
+*/
+void build_graph(Graph* g) {
+    int i, e;
+    int* pos;
+
+    g->offset = (int*)xmalloc(sizeof(int) * (g->n + 1));
+    g->adj = (int*)xmalloc(sizeof(int) * 2 * g->m);
+    g->eid = (int*)xmalloc(sizeof(int) * 2 * g->m);
+
+    memset(g->offset, 0, sizeof(int) * (g->n + 1));
+    for (e = 0; e < g->m; e++) {
+        g->offset[g->eu[e] + 1]++;
+        g->offset[g->ev[e] + 1]++;
+    }
+    for (i = 0; i < g->n; i++)
+        g->offset[i + 1] += g->offset[i];
+
+    pos = (int*)xmalloc(sizeof(int) * (g->n + 1));
+    memcpy(pos, g->offset, sizeof(int) * (g->n + 1));
+    for (e = g->m - 1; e >= 0; e--) {
+        int u = g->eu[e], v = g->ev[e];
+        g->adj[pos[u]] = v;
+        g->eid[pos[u]++] = e;
+        g->adj[pos[v]] = u;
+        g->eid[pos[v]++] = e;
+    }
+    free(pos);
+}
+
+void free_graph(Graph* g) {
+    free(g->offset);
+    free(g->adj);
+    free(g->eid);
+    free(g->eu);
+    free(g->ev);
+    memset(g, 0, sizeof(*g));
+}
+
+/*
+    ===== union-find =====
+    - parent[x] == x 이면 x가 집합의 대표
+    - find : 경로 절반 압축 (path halving), 반복문만 사용
+    - unite : 크기가 작은 집합을 큰 집합 아래에 붙임 (union by size)
+    → 연산 하나당 거의 상수 시간
+*/
+int find(int* parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+void unite(int* parent, int* size, int a, int b) {
+    a = find(parent, a);
+    b = find(parent, b);
+    if (a == b) return;
+    if (size[a] < size[b]) {
+        int tmp = a;
+        a = b;
+        b = tmp;
+    }
+    parent[b] = a;
+    size[a] += size[b];
+}
+
+/*
+    ===== connected_components =====
+    - 간선마다 양 끝을 unite 한 뒤 대표가 같은 정점끼리 같은 요소
+    - comp[v] : 정점 v의 요소 번호 (가장 작은 정점이 속한 요소부터 0, 1, 2, ...)
+    - 반환값 : 요소 개수
+*/
+int connected_components(const Graph* g, int* comp) {
+    int* parent = (int*)xmalloc(sizeof(int) * g->n);
+    int* size = (int*)xmalloc(sizeof(int) * g->n);
+    int i, count = 0;
+
+    for (i = 0; i < g->n; i++) {
+        parent[i] = i;
+        size[i] = 1;
+    }
+    for (i = 0; i < g->m; i++)
+        unite(parent, size, g->eu[i], g->ev[i]);
+
+    // 대표 정점 → 요소 번호 (size 배열을 번호표로 재사용)
+    for (i = 0; i < g->n; i++) size[i] = -1;
+    for (i = 0; i < g->n; i++) {
+        int r = find(parent, i);
+        if (size[r] < 0) size[r] = count++;
+        comp[i] = size[r];
+    }
+
+    free(parent);
+    free(size);
+    return count;
+}
+
+/*
+    ===== bridges_and_articulation_points (반복형 Tarjan) =====
+
+    [정의]
+    - disc[v] : DFS에서 v를 처음 방문한 순서
+    - low[v]  : v의 DFS 서브트리에서 "부모로 가는 간선을 제외한" 간선 하나로
+                닿을 수 있는 가장 작은 disc
+    - 트리 간선 (p, v) 에 대해
+        low[v] >  disc[p] → (p, v) 는 단절선
+        low[v] >= disc[p] → p 는 단절점 (p가 루트가 아닐 때)
+    - 루트는 DFS 자식이 2개 이상일 때만 단절점
+
+    [반복 구현]
+    - 스택 원소 : (정점, 들어올 때 쓴 간선 번호, 다음에 볼 이웃 위치)
+    - 이웃을 모두 본 정점을 꺼낼 때 부모의 low 를 갱신 (재귀의 복귀 시점)
+    - 들어온 간선은 정점이 아니라 간선 번호로 건너뛰므로
+      중복 간선 (u, v), (u, v) 는 단절선이 되지 않음
+
+    [결과]
+    - is_bridge[e] : 간선 e가 단절선이면 TRUE
+    - is_cut[v]    : 정점 v가 단절점이면 TRUE
+*/
+void bridges_and_articulation_points(const Graph* g, char* is_bridge, char* is_cut) {
+    int* disc = (int*)xmalloc(sizeof(int) * g->n);
+    int* low = (int*)xmalloc(sizeof(int) * g->n);
+    int* stack_v = (int*)xmalloc(sizeof(int) * g->n);
+    int* stack_in = (int*)xmalloc(sizeof(int) * g->n);
+    int* stack_k = (int*)xmalloc(sizeof(int) * g->n);
+    int i, r, timer = 0;
+
+    for (i = 0; i < g->n; i++) disc[i] = -1;
+    memset(is_bridge, FALSE, g->m);
+    memset(is_cut, FALSE, g->n);
+
+    for (r = 0; r < g->n; r++) {
+        int top = 0, root_children = 0;
+
+        if (disc[r] != -1) continue;
+        disc[r] = low[r] = timer++;
+        stack_v[top] = r;
+        stack_in[top] = -1;
+        stack_k[top++] = g->offset[r];
+
+        while (top) {
+            int v = stack_v[top - 1];
+            int k = stack_k[top - 1];
+
+            if (k < g->offset[v + 1]) {     // 다음 이웃 확인
+                int w = g->adj[k];
+                stack_k[top - 1] = k + 1;
+                if (g->eid[k] == stack_in[top - 1]) continue;   // 들어온 간선
+
+                if (disc[w] == -1) {        // 트리 간선 → 내려감
+                    disc[w] = low[w] = timer++;
+                    stack_v[top] = w;
+                    stack_in[top] = g->eid[k];
+                    stack_k[top++] = g->offset[w];
+                }
+                else if (disc[w] < low[v]) {    // 역방향 간선
+                    low[v] = disc[w];
+                }
+                continue;
+            }
+
+            // v의 이웃을 모두 봄 → 부모 p 로 되돌아감
+            top--;
+            if (top == 0) break;
+
+            int p = stack_v[top - 1];
+            if (low[v] < low[p]) low[p] = low[v];
+            if (low[v] > disc[p]) is_bridge[stack_in[top]] = TRUE;
+            if (top - 1 == 0) root_children++;
+            else if (low[v] >= disc[p]) is_cut[p] = TRUE;
+        }
+
+        if (root_children >= 2) is_cut[r] = TRUE;
+    }
+
+    free(disc);
+    free(low);
+    free(stack_v);
+    free(stack_in);
+    free(stack_k);
+}
+
+/*
+    ===== main =====
+    10장.cpp 와 같은 입력 형식 (노드 수, 간선 (vi vj) ... -1 -1)
+*/
+int main(void) {
+    Graph g;
+    int n, u, v, i, c, capacity = 0;
+    int count, found;
+    int* comp;
+    int* start;
+    int* members;
+    char* is_bridge;
+    char* is_cut;
+
+    memset(&g, 0, sizeof(g));
+
+    printf("무방향성 그래프 생성\n");
+    printf("  노드 개수(n): ");
+    if (scanf("%d", &n) != 1 || n <= 0)
+        return 0;
+    g.n = n;
+
+    while (1) {
+        printf("  에지 정보(vi vj) : ");
+        if (scanf("%d %d", &u, &v) != 2)
+            return 0;
+        if (u == -1 && v == -1)
+            break;
+        if (u < 0 || u >= n || v < 0 || v >= n) {
+            fprintf(stderr, "  정점 번호 오류 (%d, %d)\n", u, v);
+            continue;
+        }
+        add_edge(&g, u, v, &capacity);
+    }
+    build_graph(&g);
+
+    /* ===== 연결 요소 ===== */
+    comp = (int*)xmalloc(sizeof(int) * n);
+    count = connected_components(&g, comp);
+
+    // 요소별로 정점 모으기 (counting sort, O(V))
+    start = (int*)xmalloc(sizeof(int) * (count + 1));
+    members = (int*)xmalloc(sizeof(int) * n);
+    memset(start, 0, sizeof(int) * (count + 1));
+    for (i = 0; i < n; i++) start[comp[i] + 1]++;
+    for (c = 0; c < count; c++) start[c + 1] += start[c];
+    for (i = 0; i < n; i++) members[start[comp[i]]++] = i;
+    for (c = count; c > 0; c--) start[c] = start[c - 1];   // 채우며 밀린 시작 위치 복원
+    start[0] = 0;
+
+    printf("\n연결 요소 : %d개\n", count);
+    for (c = 0; c < count; c++) {
+        printf("  요소 %d :", c);
+        for (i = start[c]; i < start[c + 1]; i++)
+            printf("%5d", members[i]);
+        printf("\n");
+    }
+    free(start);
+    free(members);
+
+    /* ===== 단절선 / 단절점 ===== */
+    is_bridge = (char*)xmalloc(g.m);
+    is_cut = (char*)xmalloc(n);
+    bridges_and_articulation_points(&g, is_bridge, is_cut);
+
+    printf("\n단절선 (bridge) :");
+    found = FALSE;
+    for (i = 0; i < g.m; i++) {
+        if (is_bridge[i]) {
+            printf("  (%d, %d)", g.eu[i], g.ev[i]);
+            found = TRUE;
+        }
+    }
+    printf(found ? "\n" : " 없음\n");
+
+    printf("단절점 (articulation point) :");
+    found = FALSE;
+    for (i = 0; i < n; i++) {
+        if (is_cut[i]) {
+            printf("%5d", i);
+            found = TRUE;
+        }
+    }
+    printf(found ? "\n" : " 없음\n");
+
+    free(comp);
+    free(is_bridge);
+    free(is_cut);
+    free_graph(&g);
+    return 0;
+}
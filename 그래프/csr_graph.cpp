@@ -0,0 +1,1346 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <stdint.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+    ===== CSR(Compressed Sparse Row) 그래프 + DFS/BFS =====
+
+    [인접 리스트(10장.cpp)와의 차이]
+    - 인접 리스트는 간선 하나마다 Node를 calloc 하고 link 포인터로 연결
+      → 탐색할 때 이웃 하나마다 포인터를 따라가며 캐시 미스 발생
+    - CSR은 모든 이웃을 하나의 연속 배열(adj)에 정점 순서대로 저장하고
+      정점 v의 이웃은 adj[offset[v]] ~ adj[offset[v + 1] - 1] 로 표현
+
+        offset : [0, 2, 5, 6, ...]     (길이 n + 1)
+        adj    : [1, 4, 0, 2, 3, 1, ...] (길이 m)
+
+    [생성 과정: O(V + E)]
+    1) (u, v) 간선들을 EdgeList 에 모음
+    2) 정점별 차수를 세고 누적합으로 offset 계산 (counting sort)
+    3) 간선을 한 번 더 훑으며 adj 에 배치
+
+    [이웃 순서]
+    - 10장.cpp 의 insert_edge 는 리스트 앞에 삽입하므로
+      이웃이 "입력의 역순"으로 저장된다.
+    - 같은 방문 순서를 얻기 위해 간선을 뒤에서부터 배치한다.
+*/
+
+#define FALSE 0
+#define TRUE 1
+
+/* ===== 간선 목록 (입력 버퍼) ===== */
+typedef struct EdgeList {
+    int* u;
+    int* v;
+    long long count;
+    long long capacity;
+} EdgeList;
+
+/* ===== CSR 그래프 ===== */
+typedef struct CsrGraph {
+    int n;              // 정점 수
+    long long m;        // 저장된 방향 간선 수 (무방향이면 입력 간선 수 * 2)
+    long long* offset;  // 정점 v의 이웃 시작 위치, 길이 n + 1
+    int* adj;           // 이웃 정점 번호, 길이 m
+} CsrGraph;
+
+void* xmalloc(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    return p;
+}
+
+void init_edge_list(EdgeList* el) {
+    el->u = el->v = NULL;
+    el->count = el->capacity = 0;
+}
+
+/* 간선 (u, v) 추가, 배열이 차면 2배로 확장 */
+void add_edge(EdgeList* el, int u, int v) {
+    if (el->count == el->capacity) {
+        el->capacity = el->capacity ? el->capacity * 2 : 1024;
+        el->u = (int*)realloc(el->u, sizeof(int) * el->capacity);
+        el->v = (int*)realloc(el->v, sizeof(int) * el->capacity);
+        if (!el->u || !el->v) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+    }
+    el->u[el->count] = u;
+    el->v[el->count] = v;
+    el->count++;
+}
+
+void free_edge_list(EdgeList* el) {
+    free(el->u);
+    free(el->v);
+    init_edge_list(el);
+}
+
+/*
+    ===== build_csr =====
+    n          : 정점 수
+    el         : 간선 목록 (정점 번호는 0 ~ n-1)
+    undirected : TRUE면 (u, v)를 u→v, v→u 두 방향으로 저장
+*/
+void build_csr(CsrGraph* g, int n, const EdgeList* el, int undirected) {
+    long long i, e;
+    long long* pos;
+
+    g->n = n;
+    g->m = undirected ? el->count * 2 : el->count;
+    g->offset = (long long*)xmalloc(sizeof(long long) * (n + 1));
+    g->adj = (int*)xmalloc(sizeof(int) * g->m);
+
+    // 1) 차수 세기 (offset[v + 1] 에 v의 차수를 임시 저장)
+    memset(g->offset, 0, sizeof(long long) * (n + 1));
+    for (e = 0; e < el->count; e++) {
+        g->offset[el->u[e] + 1]++;
+        if (undirected) g->offset[el->v[e] + 1]++;
+    }
+
+    // 2) 누적합 → 각 정점의 시작 위치
+    for (i = 0; i < n; i++)
+        g->offset[i + 1] += g->offset[i];
+
+    // 3) 간선 배치 (뒤에서부터: 인접 리스트의 앞 삽입 순서와 동일하게)
+    pos = (long long*)xmalloc(sizeof(long long) * (n + 1));
+    memcpy(pos, g->offset, sizeof(long long) * (n + 1));
+    for (e = el->count - 1; e >= 0; e--) {
+        int u = el->u[e], v = el->v[e];
+        g->adj[pos[u]++] = v;
+        if (undirected) g->adj[pos[v]++] = u;
+    }
+    free(pos);
+}
+
+void free_csr(CsrGraph* g) {
+    free(g->offset);
+    free(g->adj);
+    g->offset = NULL;
+    g->adj = NULL;
+    g->n = 0;
+    g->m = 0;
+}
+
+/* 정점 v의 차수: 배열 두 칸의 차이, O(1) */
+int degree(const CsrGraph* g, int v) {
+    return (int)(g->offset[v + 1] - g->offset[v]);
+}
+
+/*
+    ===== print_graph_and_degree =====
+    - 10장.cpp 와 같은 형식으로 인접 정보 출력
+    - 차수는 리스트를 세지 않고 offset 차이로 바로 계산
+*/
+void print_graph_and_degree(const CsrGraph* g) {
+    int i, max_degree = -1, max_vertex = -1;
+    long long e;
+
+    printf("\n  CSR을 이용하여 구성한 그래프\n");
+    for (i = 0; i < g->n; i++) {
+        printf("   [%d]:", i);
+        for (e = g->offset[i]; e < g->offset[i + 1]; e++)
+            printf("  %d ->", g->adj[e]);
+        printf(" end\n");
+
+        if (degree(g, i) > max_degree) {
+            max_degree = degree(g, i);
+            max_vertex = i;
+        }
+    }
+    if (max_vertex < 0) return;
+
+    printf("\n  degree가 가장 큰 노드와 degree 값 : 노드 %d, degree %d\n",
+        max_vertex, max_degree);
+
+    printf("  노드 %d와 연결된 노드들 :", max_vertex);
+    for (e = g->offset[max_vertex]; e < g->offset[max_vertex + 1]; e++)
+        printf("  %d ->", g->adj[e]);
+    printf(" end\n");
+}
+
+/*
+    ===== 탐색 공용 작업 공간 =====
+    - visited : 방문 표시 (세대 번호)
+    - stack   : DFS용 (정점, 다음에 볼 이웃 위치) 쌍
+    - queue   : BFS용 배열 큐 (각 정점은 최대 한 번만 들어가므로 크기 n이면 충분)
+    - 한 번 할당해 두고 여러 시작 정점에서 재사용
+
+    [세대 번호(epoch) 방식의 방문 표시]
+    - visited[v] 에 v를 방문한 탐색의 세대 번호를 저장하고
+      visited[v] == epoch 일 때만 "방문함"으로 본다.
+    - reset_visited 는 epoch 만 1 증가 → 시작 정점마다 O(n) 초기화가 사라짐
+    - epoch 가 한 바퀴 돌아 0이 될 때만 배열 전체를 지움
+*/
+typedef struct Traversal {
+    unsigned int* visited;
+    unsigned int epoch;
+    int n;
+    int* stack_v;
+    long long* stack_e;
+    int* queue;
+} Traversal;
+
+void init_traversal(Traversal* t, const CsrGraph* g) {
+    t->n = g->n;
+    t->epoch = 1;
+    t->visited = (unsigned int*)xmalloc(sizeof(unsigned int) * g->n);
+    memset(t->visited, 0, sizeof(unsigned int) * g->n);
+    t->stack_v = (int*)xmalloc(sizeof(int) * g->n);
+    t->stack_e = (long long*)xmalloc(sizeof(long long) * g->n);
+    t->queue = (int*)xmalloc(sizeof(int) * g->n);
+}
+
+/* 새 탐색 시작: O(1) */
+void reset_visited(Traversal* t) {
+    if (++t->epoch == 0) {
+        memset(t->visited, 0, sizeof(unsigned int) * t->n);
+        t->epoch = 1;
+    }
+}
+
+int is_visited(const Traversal* t, int v) {
+    return t->visited[v] == t->epoch;
+}
+
+void mark_visited(Traversal* t, int v) {
+    t->visited[v] = t->epoch;
+}
+
+void free_traversal(Traversal* t) {
+    free(t->visited);
+    free(t->stack_v);
+    free(t->stack_e);
+    free(t->queue);
+}
+
+/*
+    ===== dfs / dfs_spanning =====
+    - 재귀 대신 명시적 스택 사용 (정점이 많아도 호출 스택이 넘치지 않음)
+    - 스택 원소: (정점 v, v의 이웃 중 다음에 확인할 위치)
+      → 재귀 DFS와 방문 순서, 신장 트리 간선이 완전히 같다.
+    - print_edges 가 TRUE면 신장 트리 간선 (부모, 자식) 출력,
+      FALSE면 방문 정점 출력
+*/
+void dfs_common(const CsrGraph* g, Traversal* t, int start, int print_edges) {
+    int top = 0;
+
+    mark_visited(t, start);
+    if (!print_edges) printf("%5d", start);
+    t->stack_v[top] = start;
+    t->stack_e[top++] = g->offset[start];
+
+    while (top) {
+        int v = t->stack_v[top - 1];
+        long long e = t->stack_e[top - 1];
+
+        // 아직 방문하지 않은 다음 이웃 찾기
+        while (e < g->offset[v + 1] && is_visited(t, g->adj[e])) e++;
+
+        if (e == g->offset[v + 1]) {    // 이웃을 모두 확인 → 되돌아감
+            top--;
+            continue;
+        }
+
+        int w = g->adj[e];
+        t->stack_e[top - 1] = e + 1;    // 돌아왔을 때 이어서 볼 위치
+        mark_visited(t, w);
+        if (print_edges) printf("  (%d, %d)", v, w);
+        else printf("%5d", w);
+        t->stack_v[top] = w;
+        t->stack_e[top++] = g->offset[w];
+    }
+}
+
+void dfs(const CsrGraph* g, Traversal* t, int v) {
+    dfs_common(g, t, v, FALSE);
+}
+
+void dfs_spanning(const CsrGraph* g, Traversal* t, int v) {
+    dfs_common(g, t, v, TRUE);
+}
+
+/*
+    ===== bfs / bfs_spanning =====
+    - 큐는 미리 할당한 배열 (head, tail 인덱스만 이동)
+    - 이웃은 연속 배열에서 순서대로 읽음
+*/
+void bfs_common(const CsrGraph* g, Traversal* t, int start, int print_edges) {
+    int head = 0, tail = 0;
+
+    mark_visited(t, start);
+    if (!print_edges) printf("%5d", start);
+    t->queue[tail++] = start;
+
+    while (head < tail) {
+        int v = t->queue[head++];
+        for (long long e = g->offset[v]; e < g->offset[v + 1]; e++) {
+            int w = g->adj[e];
+            if (!is_visited(t, w)) {
+                mark_visited(t, w);
+                if (print_edges) printf("  (%d, %d)", v, w);
+                else printf("%5d", w);
+                t->queue[tail++] = w;
+            }
+        }
+    }
+}
+
+void bfs(const CsrGraph* g, Traversal* t, int v) {
+    bfs_common(g, t, v, FALSE);
+}
+
+void bfs_spanning(const CsrGraph* g, Traversal* t, int v) {
+    bfs_common(g, t, v, TRUE);
+}
+
+/*
+    ===== 비트 집합 =====
+    - 정점 하나당 1비트 (char 배열의 1/8 크기)
+    - bottom-up 단계처럼 임의의 정점을 반복해서 확인할 때
+      캐시에 더 많은 정점이 들어가므로 메모리 접근이 줄어든다.
+*/
+typedef unsigned long long BitWord;
+#define WORD_BITS 64
+
+BitWord* alloc_bitset(int n) {
+    size_t words = ((size_t)n + WORD_BITS - 1) / WORD_BITS;
+    BitWord* bits = (BitWord*)xmalloc(sizeof(BitWord) * words);
+    memset(bits, 0, sizeof(BitWord) * words);
+    return bits;
+}
+
+int test_bit(const BitWord* bits, int v) {
+    return (int)((bits[v / WORD_BITS] >> (v % WORD_BITS)) & 1);
+}
+
+void set_bit(BitWord* bits, int v) {
+    bits[v / WORD_BITS] |= (BitWord)1 << (v % WORD_BITS);
+}
+
+void clear_bit(BitWord* bits, int v) {
+    bits[v / WORD_BITS] &= ~((BitWord)1 << (v % WORD_BITS));
+}
+
+/* 0이 아닌 워드에서 가장 낮은 켜진 비트의 위치 */
+int lowest_bit(BitWord x) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (int)i;
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+/*
+    ===== parallel_for =====
+    - [0, count) 구간을 threads 개의 연속 조각으로 나눠 스레드마다 fn(tid, begin, end) 호출
+    - 조각은 번호 순서대로 앞에서부터 배정되므로
+      tid 순서로 결과를 이어 붙이면 직렬 실행과 같은 순서가 된다.
+    - 일이 grain 보다 적으면 스레드 생성 비용이 더 크므로 현재 스레드에서 바로 실행
+      (스레드마다 큰 일을 하나씩 맡길 때는 grain 을 1로)
+*/
+#define PARALLEL_GRAIN 4096
+
+template <typename F>
+void parallel_for(int threads, long long count, F fn, long long grain = PARALLEL_GRAIN) {
+    if (threads <= 1 || count < grain) {
+        fn(0, 0LL, count);
+        for (int t = 1; t < threads; t++) fn(t, count, count);  // 빈 조각
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    long long chunk = (count + threads - 1) / threads;
+    for (int t = 0; t < threads; t++) {
+        long long begin = chunk * t < count ? chunk * t : count;
+        long long end = begin + chunk < count ? begin + chunk : count;
+        pool.emplace_back(fn, t, begin, end);
+    }
+    for (auto& th : pool) th.join();
+}
+
+/*
+    ===== 방향 최적화(direction-optimizing) 병렬 BFS =====
+
+    [레벨 동기 방식]
+    - 현재 레벨의 frontier 전체를 스레드들이 나눠 처리한 뒤
+      다음 레벨의 frontier를 만들고 나서 다음 단계로 넘어감
+
+    [top-down 단계]
+    - frontier의 각 정점 v가 이웃 w를 확인하고
+      level[w]를 -1 → L+1 로 CAS(compare-and-swap) 한 스레드만 w를 차지
+    - frontier가 작을 때 유리
+
+    [bottom-up 단계]
+    - 아직 방문하지 않은 정점 w가 자기 이웃 중 frontier에 속한 정점을
+      찾는 즉시 멈춤 (early exit) → level[w]는 w를 맡은 스레드만 쓰므로 원자 연산 불필요
+    - frontier가 그래프의 큰 부분을 차지할 때 확인할 간선 수가 크게 줄어듦
+    - 무방향 그래프 가정 (w의 이웃 = w로 들어오는 간선)
+
+    [전환 규칙 (Beamer)]
+    - m_f : frontier 정점들의 차수 합, m_u : 미방문 정점들의 차수 합
+    - top-down → bottom-up : m_f > m_u / ALPHA
+    - bottom-up → top-down : n_f < n / BETA
+
+    [직렬 bfs_spanning 과 같은 결과 만들기 (canonical 옵션)]
+    - 위 탐색으로 얻는 레벨은 직렬 BFS와 항상 같지만,
+      부모와 레벨 안의 방문 순서는 스레드 실행 순서에 따라 달라질 수 있다.
+    - 직렬 BFS에서 w의 부모는 "이전 레벨에서 큐 순서가 가장 빠른 이웃"이고,
+      같은 레벨 안의 순서는 (부모의 큐 순서, 부모 인접 배열 안의 위치) 순이다.
+    - canonical 이 TRUE면 레벨마다 이 규칙으로 부모/순서를 다시 정한다 (O(E), 병렬).
+*/
+#define DO_BFS_ALPHA 14
+#define DO_BFS_BETA 24
+
+typedef struct BfsResult {
+    int* level;         // 시작 정점으로부터의 레벨, 미방문은 -1
+    int* parent;        // BFS 신장 트리 부모, 시작 정점과 미방문은 -1
+    int* order;         // 방문 순서 (count개)
+    int count;          // 방문한 정점 수
+    int top_down_steps;
+    int bottom_up_steps;
+} BfsResult;
+
+void free_bfs_result(BfsResult* r) {
+    free(r->level);
+    free(r->parent);
+    free(r->order);
+    memset(r, 0, sizeof(*r));
+}
+
+/* tid 순서대로 스레드별 목록을 dst 뒤에 이어 붙이고 새 길이 반환 */
+int concat_locals(std::vector<std::vector<int> >& local, int* dst, int size) {
+    for (auto& part : local) {
+        if (!part.empty())
+            memcpy(dst + size, part.data(), sizeof(int) * part.size());
+        size += (int)part.size();
+        part.clear();
+    }
+    return size;
+}
+
+void bfs_parallel(const CsrGraph* g, int start, int threads, int canonical, BfsResult* r) {
+    int n = g->n;
+    std::atomic<int>* level = new std::atomic<int>[n];
+    BitWord* in_frontier = alloc_bitset(n);       // bottom-up 단계의 frontier 표시
+    int* frontier = (int*)xmalloc(sizeof(int) * n);   // 모든 레벨의 frontier를 순서대로 저장
+    int* level_begin = (int*)xmalloc(sizeof(int) * (n + 1));
+    std::vector<std::vector<int> > local(threads);
+    long long m_u = g->m;
+    int depth = 0, size = 0, bottom_up = FALSE;
+
+    parallel_for(threads, n, [&](int, long long b, long long e) {
+        for (long long i = b; i < e; i++) level[i].store(-1, std::memory_order_relaxed);
+    });
+
+    r->top_down_steps = r->bottom_up_steps = 0;
+    level[start] = 0;
+    frontier[size++] = start;
+    level_begin[0] = 0;
+    level_begin[1] = size;
+    m_u -= degree(g, start);
+
+    while (level_begin[depth + 1] > level_begin[depth]) {
+        int fb = level_begin[depth], fe = level_begin[depth + 1];
+        int n_f = fe - fb;
+        long long m_f = 0;
+
+        for (int i = fb; i < fe; i++) m_f += degree(g, frontier[i]);
+
+        // 방향 결정
+        if (!bottom_up && m_f > m_u / DO_BFS_ALPHA) bottom_up = TRUE;
+        else if (bottom_up && n_f < n / DO_BFS_BETA) bottom_up = FALSE;
+
+        if (!bottom_up) {
+            r->top_down_steps++;
+            parallel_for(threads, n_f, [&](int tid, long long b, long long e) {
+                for (long long i = fb + b; i < fb + e; i++) {
+                    int v = frontier[i];
+                    for (long long k = g->offset[v]; k < g->offset[v + 1]; k++) {
+                        int w = g->adj[k], expected = -1;
+                        if (level[w].load(std::memory_order_relaxed) == -1 &&
+                            level[w].compare_exchange_strong(expected, depth + 1))
+                            local[tid].push_back(w);
+                    }
+                }
+            });
+        }
+        else {
+            r->bottom_up_steps++;
+            for (int i = fb; i < fe; i++) set_bit(in_frontier, frontier[i]);
+            parallel_for(threads, n, [&](int tid, long long b, long long e) {
+                for (long long w = b; w < e; w++) {
+                    if (level[w].load(std::memory_order_relaxed) != -1) continue;
+                    for (long long k = g->offset[w]; k < g->offset[w + 1]; k++) {
+                        if (test_bit(in_frontier, g->adj[k])) {
+                            level[w].store(depth + 1, std::memory_order_relaxed);
+                            local[tid].push_back((int)w);
+                            break;  // frontier 이웃을 하나 찾으면 충분
+                        }
+                    }
+                }
+            });
+            for (int i = fb; i < fe; i++) clear_bit(in_frontier, frontier[i]);
+        }
+
+        size = concat_locals(local, frontier, size);
+        depth++;
+        level_begin[depth + 1] = size;
+        for (int i = fe; i < size; i++) m_u -= degree(g, frontier[i]);
+    }
+
+    r->count = size;
+    r->level = (int*)xmalloc(sizeof(int) * n);
+    r->parent = (int*)xmalloc(sizeof(int) * n);
+    r->order = (int*)xmalloc(sizeof(int) * (size > 0 ? size : 1));
+    parallel_for(threads, n, [&](int, long long b, long long e) {
+        for (long long i = b; i < e; i++) {
+            r->level[i] = level[i].load(std::memory_order_relaxed);
+            r->parent[i] = -1;
+        }
+    });
+    delete[] level;
+
+    if (!canonical) {
+        // 부모: 이전 레벨의 아무 이웃이나 (병렬로 첫 번째 것), 순서: 찾은 순서 그대로
+        memcpy(r->order, frontier, sizeof(int) * size);
+        parallel_for(threads, size - 1, [&](int, long long b, long long e) {
+            for (long long i = 1 + b; i < 1 + e; i++) {
+                int w = frontier[i];
+                for (long long k = g->offset[w]; k < g->offset[w + 1]; k++)
+                    if (r->level[g->adj[k]] == r->level[w] - 1) {
+                        r->parent[w] = g->adj[k];
+                        break;
+                    }
+            }
+        });
+    }
+    else {
+        // 직렬 BFS와 같은 부모/순서를 레벨마다 다시 계산
+        int* pos = (int*)xmalloc(sizeof(int) * n);  // order 안의 위치 (= 큐 순서)
+        int placed = 1;
+
+        for (int v = 0; v < n; v++) pos[v] = -1;   // -1: 아직 내보내지 않음
+        r->order[0] = start;
+        pos[start] = 0;
+        for (int L = 1; L < depth; L++) {
+            int lb = level_begin[L], le = level_begin[L + 1];
+            int pb = placed - (level_begin[L] - level_begin[L - 1]);  // 이전 레벨의 order 시작
+
+            // 1) 부모 = 이전 레벨 이웃 중 큐 순서가 가장 빠른 정점
+            parallel_for(threads, le - lb, [&](int, long long b, long long e) {
+                for (long long i = lb + b; i < lb + e; i++) {
+                    int w = frontier[i], best = -1;
+                    for (long long k = g->offset[w]; k < g->offset[w + 1]; k++) {
+                        int u = g->adj[k];
+                        if (r->level[u] == L - 1 && (best < 0 || pos[u] < pos[best]))
+                            best = u;
+                    }
+                    r->parent[w] = best;
+                }
+            });
+
+            // 2) 이전 레벨을 순서대로 나눠 맡아 자식을 인접 배열 순서로 내보냄
+            //    w는 부모를 맡은 스레드만 내보내므로 중복/경쟁 없음
+            parallel_for(threads, placed - pb, [&](int tid, long long b, long long e) {
+                for (long long i = pb + b; i < pb + e; i++) {
+                    int v = r->order[i];
+                    for (long long k = g->offset[v]; k < g->offset[v + 1]; k++) {
+                        int w = g->adj[k];
+                        if (r->parent[w] == v && r->level[w] == L && pos[w] != -2) {
+                            pos[w] = -2;    // 이미 내보냄 (중복 간선 대비)
+                            local[tid].push_back(w);
+                        }
+                    }
+                }
+            });
+            int new_placed = concat_locals(local, r->order, placed);
+            for (int i = placed; i < new_placed; i++) pos[r->order[i]] = i;
+            placed = new_placed;
+        }
+        free(pos);
+    }
+
+    free(in_frontier);
+    free(frontier);
+    free(level_begin);
+}
+
+/*
+    ===== 다중 시작 BFS (MS-BFS, bit-parallel) =====
+
+    [아이디어]
+    - 시작 정점 k개에서 BFS를 따로 k번 돌리면 같은 인접 배열을 k번 읽는다.
+    - 정점마다 비트 묶음을 두고 i번째 비트를 "i번째 시작 정점의 BFS"로 쓰면
+      인접 배열을 한 번 훑는 동안 최대 MS_BFS_LANES 개의 BFS가 함께 진행된다.
+
+        seen[v]  : v에 이미 도달한 BFS들 (비트 i = 시작 정점 i)
+        visit[v] : 이번 레벨에 v가 frontier인 BFS들
+
+    [한 레벨 (pull 방식)]
+    - 정점 w마다 이웃 v들의 visit[v]를 OR 한 뒤 seen[w]에 없는 비트만 남김
+        next[w] = (OR visit[v]) & ~seen[w]
+      → next[w]의 비트 i가 켜지면 시작 정점 i에서 w까지의 거리 = 현재 레벨
+    - w의 값은 w를 맡은 스레드만 쓰므로 원자 연산 없이 parallel_for 로 나눠 처리
+    - 무방향 그래프 가정 (w의 이웃 = w로 들어오는 간선)
+
+    [결과]
+    - dist[i * n + v] : sources[i] 에서 v까지의 거리, 도달할 수 없으면 -1
+    - 시작 정점이 MS_BFS_LANES 개보다 많으면 그만큼씩 나눠 여러 번 실행
+*/
+#define MS_BFS_WORDS 4                              // 정점당 워드 수
+#define MS_BFS_LANES (MS_BFS_WORDS * WORD_BITS)     // 한 번에 처리하는 시작 정점 수 (256)
+
+void ms_bfs(const CsrGraph* g, const int* sources, int k, int threads, int* dist) {
+    int n = g->n;
+    size_t words = (size_t)n * MS_BFS_WORDS;
+    BitWord* seen = (BitWord*)xmalloc(sizeof(BitWord) * words);
+    BitWord* visit = (BitWord*)xmalloc(sizeof(BitWord) * words);
+    BitWord* next = (BitWord*)xmalloc(sizeof(BitWord) * words);
+    std::vector<char> active(threads);
+
+    for (long long i = 0; i < (long long)k * n; i++) dist[i] = -1;
+
+    for (int base = 0; base < k; base += MS_BFS_LANES) {
+        int lanes = k - base < MS_BFS_LANES ? k - base : MS_BFS_LANES;
+        int level = 0, any = TRUE;
+
+        memset(seen, 0, sizeof(BitWord) * words);
+        memset(visit, 0, sizeof(BitWord) * words);
+        for (int i = 0; i < lanes; i++) {
+            int s = sources[base + i];
+            seen[(size_t)s * MS_BFS_WORDS + i / WORD_BITS] |= (BitWord)1 << (i % WORD_BITS);
+            visit[(size_t)s * MS_BFS_WORDS + i / WORD_BITS] |= (BitWord)1 << (i % WORD_BITS);
+            dist[(long long)(base + i) * n + s] = 0;
+        }
+
+        while (any) {
+            level++;
+            parallel_for(threads, n, [&](int tid, long long b, long long e) {
+                char found = FALSE;
+                for (long long w = b; w < e; w++) {
+                    BitWord* nw = next + w * MS_BFS_WORDS;
+                    BitWord* sw = seen + w * MS_BFS_WORDS;
+                    BitWord acc[MS_BFS_WORDS] = { 0 };
+
+                    for (long long kk = g->offset[w]; kk < g->offset[w + 1]; kk++) {
+                        const BitWord* vv = visit + (size_t)g->adj[kk] * MS_BFS_WORDS;
+                        for (int j = 0; j < MS_BFS_WORDS; j++) acc[j] |= vv[j];
+                    }
+                    for (int j = 0; j < MS_BFS_WORDS; j++) {
+                        BitWord d = acc[j] & ~sw[j];    // 이번 레벨에 처음 도달한 BFS들
+                        nw[j] = d;
+                        if (!d) continue;
+                        sw[j] |= d;
+                        found = TRUE;
+                        while (d) {                     // 켜진 비트마다 거리 기록
+                            int bit = lowest_bit(d);
+                            dist[(long long)(base + j * WORD_BITS + bit) * n + w] = level;
+                            d &= d - 1;
+                        }
+                    }
+                }
+                active[tid] = found;
+            });
+
+            BitWord* tmp = visit;
+            visit = next;
+            next = tmp;
+            any = FALSE;
+            for (int t = 0; t < threads; t++) any |= active[t];
+        }
+    }
+
+    free(seen);
+    free(visit);
+    free(next);
+}
+
+/*
+    ===== 파일에서 간선 목록 읽기 (대용량 그래프) =====
+
+    [문제]
+    - 대화형 입력은 scanf 로 간선을 하나씩 읽으므로 간선이 수억 개면 몇 시간이 걸림
+
+    [방법]
+    - 파일 전체를 mmap 으로 매핑 (read 로 복사하지 않음)
+    - 텍스트 : 파일을 스레드 수만큼 줄 경계에서 잘라 각자 파싱 → 순서대로 이어 붙임
+    - 바이너리 : 매핑된 (u, v) 배열을 파싱 없이 그대로 사용
+    - 두 경우 모두 (u, v) 쌍 배열에서 바로 CSR 을 병렬로 생성 (build_csr_pairs)
+
+    [텍스트 형식]
+    - 한 줄에 "u v" (세 번째 이후 값은 무시, '#' / '%' 로 시작하는 줄은 주석)
+    - 첫 줄에 정수가 하나뿐이면 정점 수로 사용 → 대화형 입력 파일도 그대로 읽힘
+    - 음수가 있는 줄(-1 -1 등)은 건너뜀
+    - 정점 수 = max(첫 줄 값, 가장 큰 정점 번호 + 1)
+
+    [바이너리 형식] (기록한 기계의 바이트 순서, little endian 가정)
+        [EdgeFileHeader][u0 v0 u1 v1 ... (uint32 쌍 m개)]
+*/
+#define EDGE_MAGIC 0x31474445u     // "EDG1"
+
+typedef struct EdgeFileHeader {
+    uint32_t magic;
+    uint32_t n;             // 정점 수
+    uint64_t m;             // 간선 수
+    uint32_t undirected;    // TRUE면 무방향 그래프
+    uint32_t pad;
+} EdgeFileHeader;
+
+/* ===== 읽기 전용 파일 매핑 ===== */
+typedef struct MappedFile {
+    const char* base;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file, mapping;
+#endif
+} MappedFile;
+
+/* 반환: 성공 0, 실패 -1 (빈 파일도 실패) */
+int map_file(MappedFile* f, const char* path) {
+    memset(f, 0, sizeof(*f));
+
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    f->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (f->file == INVALID_HANDLE_VALUE) return -1;
+    GetFileSizeEx(f->file, &size);
+    f->size = (size_t)size.QuadPart;
+    f->mapping = f->size ? CreateFileMappingA(f->file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+    if (!f->mapping) {
+        CloseHandle(f->file);
+        return -1;
+    }
+    f->base = (const char*)MapViewOfFile(f->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!f->base) {
+        CloseHandle(f->mapping);
+        CloseHandle(f->file);
+        return -1;
+    }
+#else
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+    f->size = (size_t)st.st_size;
+    void* p = mmap(NULL, f->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // 매핑은 fd를 닫아도 유지됨
+    if (p == MAP_FAILED) return -1;
+    madvise(p, f->size, MADV_SEQUENTIAL);   // 앞에서부터 읽으므로 미리 읽기 요청
+    f->base = (const char*)p;
+#endif
+    return 0;
+}
+
+void unmap_file(MappedFile* f) {
+    if (!f->base) return;
+#ifdef _WIN32
+    UnmapViewOfFile(f->base);
+    CloseHandle(f->mapping);
+    CloseHandle(f->file);
+#else
+    munmap((void*)f->base, f->size);
+#endif
+    f->base = NULL;
+}
+
+/* ===== 텍스트 파싱 도우미 ===== */
+
+/* p부터 줄 끝까지 건너뛰고 다음 줄의 시작 반환 */
+const char* next_line(const char* p, const char* end) {
+    const char* nl = (const char*)memchr(p, '\n', end - p);
+    return nl ? nl + 1 : end;
+}
+
+/*
+    한 줄에서 음이 아닌 정수를 최대 max_count 개 읽음 (scanf 보다 훨씬 빠름)
+    반환: 읽은 개수, 음수/숫자가 아닌 값을 만나면 -1
+    *line 은 다음 줄의 시작으로 이동
+*/
+int parse_line(const char** line, const char* end, unsigned long long* out, int max_count) {
+    const char* p = *line;
+    int count = 0;
+
+    while (p < end && *p != '\n') {
+        if (*p == ' ' || *p == '\t' || *p == '\r' || *p == ',') {
+            p++;
+            continue;
+        }
+        if (count == 0 && (*p == '#' || *p == '%')) break;     // 주석 줄
+        if (*p < '0' || *p > '9') {
+            count = -1;
+            break;
+        }
+        unsigned long long x = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (x < 0xFFFFFFFFFFull) x = x * 10 + (unsigned)(*p - '0');   // 너무 큰 값은 그대로 둠
+            p++;
+        }
+        if (count < max_count) out[count] = x;
+        count++;
+    }
+    *line = next_line(p, end);
+    if (count > max_count) count = max_count;
+    return count;
+}
+
+/*
+    ===== build_csr_pairs =====
+    - pairs[2e], pairs[2e + 1] : e번째 간선 (u, v), 모든 정점 번호는 n 미만이어야 함
+    - build_csr 와 같은 counting sort 를 간선 조각별로 나눠 병렬 처리
+
+    [방법]
+    - 간선을 스레드 수만큼 연속 조각으로 나누고 스레드 t는 조각 t만 담당
+    1) 조각마다 정점별 개수를 따로 셈 : cnt[t][v]
+    2) 정점 v의 행 안에서 조각 T-1, T-2, ..., 0 순서로 자리를 나눠 줌
+    3) 각 스레드가 자기 조각을 뒤에서부터 자기 자리에 배치
+    → 원자 연산이 필요 없고, 결과가 build_csr 와 완전히 같다 (이웃 순서 포함).
+    - 원자 연산(lock 접두 명령)으로 자리를 가져가면 캐시 미스가 겹치지 못해 훨씬 느림
+
+    [메모리]
+    - 조각별 카운터가 스레드 수 * (n + 1) 칸이므로
+      간선 배열보다 커지지 않도록 정점에 비해 간선이 적으면 스레드 수를 줄임
+*/
+void build_csr_pairs(CsrGraph* g, int n, const uint32_t* pairs, long long m,
+                     int undirected, int threads) {
+    long long stride = (long long)n + 1;
+    if ((long long)threads * stride > 2 * m + PARALLEL_GRAIN)
+        threads = (int)((2 * m + PARALLEL_GRAIN) / stride);
+    if (threads < 1) threads = 1;
+
+    long long* cnt = (long long*)xmalloc(sizeof(long long) * threads * stride);
+
+    g->n = n;
+    g->m = undirected ? m * 2 : m;
+    g->offset = (long long*)xmalloc(sizeof(long long) * (n + 1));
+    g->adj = (int*)xmalloc(sizeof(int) * g->m);
+
+    // 1) 조각별 차수 세기
+    parallel_for(threads, threads, [&](int, long long tb, long long te) {
+        for (long long t = tb; t < te; t++) {
+            long long* c = cnt + t * stride;
+            memset(c, 0, sizeof(long long) * stride);
+            for (long long i = m * t / threads; i < m * (t + 1) / threads; i++) {
+                c[pairs[2 * i]]++;
+                if (undirected) c[pairs[2 * i + 1]]++;
+            }
+        }
+    }, 1);
+
+    // 2) 정점별 전체 차수 → 누적합 → 조각별 시작 위치
+    parallel_for(threads, n, [&](int, long long b, long long e) {
+        for (long long v = b; v < e; v++) {
+            long long d = 0;
+            for (int t = 0; t < threads; t++) d += cnt[t * stride + v];
+            g->offset[v + 1] = d;
+        }
+    });
+    g->offset[0] = 0;
+    for (int i = 0; i < n; i++)
+        g->offset[i + 1] += g->offset[i];
+    parallel_for(threads, n, [&](int, long long b, long long e) {
+        for (long long v = b; v < e; v++) {
+            long long pos = g->offset[v];
+            for (int t = threads - 1; t >= 0; t--) {    // 뒤쪽 조각이 행의 앞부분
+                long long d = cnt[t * stride + v];
+                cnt[t * stride + v] = pos;
+                pos += d;
+            }
+        }
+    });
+
+    // 3) 간선 배치 (build_csr 처럼 뒤에서부터)
+    parallel_for(threads, threads, [&](int, long long tb, long long te) {
+        for (long long t = tb; t < te; t++) {
+            long long* pos = cnt + t * stride;
+            for (long long i = m * (t + 1) / threads - 1; i >= m * t / threads; i--) {
+                uint32_t u = pairs[2 * i], v = pairs[2 * i + 1];
+                g->adj[pos[u]++] = (int)v;
+                if (undirected) g->adj[pos[v]++] = (int)u;
+            }
+        }
+    }, 1);
+
+    free(cnt);
+}
+
+/* ===== 읽기 결과 ===== */
+typedef struct LoadStats {
+    long long bytes;        // 파일 크기
+    long long edges;        // 읽은 간선 수
+    int undirected;         // 무방향으로 저장했으면 TRUE
+    double map_sec;         // 매핑 (+ 텍스트 파싱)
+    double build_sec;       // CSR 생성
+} LoadStats;
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+    텍스트 간선 목록을 스레드별로 파싱해 (u, v) 쌍 배열로 만듦
+    - 스레드 t는 파일의 t번째 조각을 맡되, 조각 중간에서 시작하는 줄은
+      앞 스레드가 끝까지 읽으므로 다음 줄부터 시작
+    - 스레드별 결과를 t 순서대로 이어 붙이므로 간선 순서는 파일 순서와 같음
+    반환: 간선 수 (오류면 -1), *pairs_out 은 호출한 쪽에서 free
+*/
+long long parse_text_edges(const MappedFile* f, int threads, uint32_t** pairs_out, int* n_out) {
+    const char* begin = f->base;
+    const char* end = f->base + f->size;
+    unsigned long long header[3];
+    std::vector<std::vector<uint32_t> > local(threads);
+    std::vector<unsigned long long> local_max(threads, 0);
+    std::vector<char> local_error(threads, FALSE);
+    unsigned long long n_hint = 0, max_id = 0;
+    long long m = 0;
+
+    // 첫 데이터 줄이 정수 하나뿐이면 정점 수
+    const char* p = begin;
+    while (p < end) {
+        const char* line = p;
+        int count = parse_line(&p, end, header, 3);
+        if (count == 0) continue;
+        if (count == 1) {
+            n_hint = header[0];
+            begin = p;
+        }
+        else begin = line;
+        break;
+    }
+
+    long long length = end - begin;
+    parallel_for(threads, threads, [&](int, long long tb, long long te) {
+        for (long long t = tb; t < te; t++) {
+            const char* q = begin + length * t / threads;
+            const char* stop = begin + length * (t + 1) / threads;
+            unsigned long long x[2];
+
+            if (t > 0 && q > begin && q[-1] != '\n') q = next_line(q, end);
+            while (q < stop) {
+                if (parse_line(&q, end, x, 2) < 2) continue;   // 빈 줄, 주석, 음수 (-1 -1) 등
+                if (x[0] >= 0x7FFFFFFFu || x[1] >= 0x7FFFFFFFu) {
+                    local_error[t] = TRUE;
+                    break;
+                }
+                local[t].push_back((uint32_t)x[0]);
+                local[t].push_back((uint32_t)x[1]);
+                if (x[0] > local_max[t]) local_max[t] = x[0];
+                if (x[1] > local_max[t]) local_max[t] = x[1];
+            }
+        }
+    }, 1);
+
+    for (int t = 0; t < threads; t++) {
+        if (local_error[t]) {
+            fprintf(stderr, "정점 번호가 너무 큽니다\n");
+            return -1;
+        }
+        m += (long long)local[t].size() / 2;
+        if (!local[t].empty() && local_max[t] + 1 > max_id) max_id = local_max[t] + 1;
+    }
+    if (n_hint > max_id) max_id = n_hint;
+    if (max_id >= 0x7FFFFFFFu) {
+        fprintf(stderr, "정점 수가 너무 큽니다\n");
+        return -1;
+    }
+
+    // 스레드별 결과를 순서대로 이어 붙임
+    uint32_t* pairs = (uint32_t*)xmalloc(sizeof(uint32_t) * 2 * m);
+    std::vector<long long> start(threads + 1, 0);
+    for (int t = 0; t < threads; t++) start[t + 1] = start[t] + (long long)local[t].size();
+    parallel_for(threads, threads, [&](int, long long tb, long long te) {
+        for (long long t = tb; t < te; t++) {
+            if (!local[t].empty())
+                memcpy(pairs + start[t], local[t].data(), sizeof(uint32_t) * local[t].size());
+            std::vector<uint32_t>().swap(local[t]);     // 메모리 바로 반환
+        }
+    }, 1);
+
+    *pairs_out = pairs;
+    *n_out = (int)max_id;
+    return m;
+}
+
+/*
+    ===== load_edge_file =====
+    - 파일 앞 4바이트가 EDG1 이면 바이너리, 아니면 텍스트로 읽어 CSR 생성
+    - 텍스트 파일은 무방향으로 읽음 (10장.cpp 입력과 같음)
+    반환: 성공 0, 실패 -1
+*/
+int load_edge_file(CsrGraph* g, const char* path, int threads, LoadStats* stats) {
+    MappedFile f;
+    auto start = std::chrono::steady_clock::now();
+
+    memset(stats, 0, sizeof(*stats));
+    if (map_file(&f, path) != 0) {
+        fprintf(stderr, "%s 를 열 수 없습니다\n", path);
+        return -1;
+    }
+    stats->bytes = (long long)f.size;
+
+    const EdgeFileHeader* h = (const EdgeFileHeader*)f.base;
+    if (f.size >= sizeof(EdgeFileHeader) && h->magic == EDGE_MAGIC) {
+        // 바이너리: 파싱 없이 매핑된 배열에서 바로 생성
+        const uint32_t* pairs = (const uint32_t*)(f.base + sizeof(EdgeFileHeader));
+        std::atomic<bool> bad(false);
+
+        if (f.size != sizeof(EdgeFileHeader) + h->m * 2 * sizeof(uint32_t) || h->n >= 0x7FFFFFFFu) {
+            fprintf(stderr, "간선 파일 형식 오류: %s\n", path);
+            unmap_file(&f);
+            return -1;
+        }
+        parallel_for(threads, (long long)h->m * 2, [&](int, long long b, long long e) {
+            for (long long i = b; i < e; i++)
+                if (pairs[i] >= h->n) bad = true;
+        });
+        if (bad) {
+            fprintf(stderr, "정점 번호 오류: %s\n", path);
+            unmap_file(&f);
+            return -1;
+        }
+        stats->edges = (long long)h->m;
+        stats->map_sec = seconds_since(start);
+
+        start = std::chrono::steady_clock::now();
+        stats->undirected = h->undirected ? TRUE : FALSE;
+        build_csr_pairs(g, (int)h->n, pairs, (long long)h->m, stats->undirected, threads);
+        stats->build_sec = seconds_since(start);
+    }
+    else {
+        uint32_t* pairs;
+        int n;
+        long long m = parse_text_edges(&f, threads, &pairs, &n);
+        if (m < 0) {
+            unmap_file(&f);
+            return -1;
+        }
+        stats->edges = m;
+        stats->map_sec = seconds_since(start);
+
+        start = std::chrono::steady_clock::now();
+        stats->undirected = TRUE;
+        build_csr_pairs(g, n, pairs, m, TRUE, threads);
+        stats->build_sec = seconds_since(start);
+        free(pairs);
+    }
+    unmap_file(&f);
+    return 0;
+}
+
+/*
+    ===== write_edge_file =====
+    - CSR 을 바이너리 간선 파일로 저장 (무방향이면 u < v 인 간선만, 한 번씩)
+    - 다음부터는 텍스트 파싱 없이 load_edge_file 로 바로 매핑
+    반환: 성공 0, 실패 -1
+*/
+int write_edge_file(const CsrGraph* g, const char* path, int undirected) {
+    FILE* fp = fopen(path, "wb");
+    EdgeFileHeader h;
+    uint32_t buf[2 * 4096];
+    int count = 0, ok;
+    long long written = 0;
+
+    if (!fp) return -1;
+    memset(&h, 0, sizeof(h));
+    h.magic = EDGE_MAGIC;
+    h.n = (uint32_t)g->n;
+    h.undirected = undirected ? TRUE : FALSE;
+    ok = fwrite(&h, sizeof(h), 1, fp) == 1;     // m 은 다 쓴 뒤에 채움
+
+    for (int u = 0; u < g->n && ok; u++) {
+        int self = 0;
+        for (long long k = g->offset[u]; k < g->offset[u + 1] && ok; k++) {
+            int v = g->adj[k];
+            if (undirected && (v < u || (v == u && (self++ & 1))))
+                continue;   // 반대 방향은 생략 (자기 루프는 두 칸 중 하나만)
+            buf[count++] = (uint32_t)u;
+            buf[count++] = (uint32_t)v;
+            written++;
+            if (count == 2 * 4096) {
+                ok = fwrite(buf, sizeof(uint32_t), count, fp) == (size_t)count;
+                count = 0;
+            }
+        }
+    }
+    ok = ok && fwrite(buf, sizeof(uint32_t), count, fp) == (size_t)count;
+
+    h.m = (uint64_t)written;
+    ok = ok && fseek(fp, 0, SEEK_SET) == 0 && fwrite(&h, sizeof(h), 1, fp) == 1;
+    ok = (fclose(fp) == 0) && ok;   // 버퍼에 남은 내용은 fclose 에서 기록됨
+    return ok ? 0 : -1;
+}
+
+/*
+    ===== print_degree_stats =====
+    - 차수는 offset 두 칸의 차이이므로 리스트를 셀 필요 없이 O(V)
+    - 정점 범위를 스레드가 나눠 처리
+        1) 스레드별 합계 / 최댓값 → 합침
+        2) 스레드별 히스토그램 → 같은 칸끼리 더함
+        3) 스레드별 상위 k개 (크기 k 최소 힙) → 후보 threads * k 개 중 다시 상위 k개
+    - 같은 차수면 번호가 작은 정점이 앞 (스레드 수와 관계없이 같은 결과)
+*/
+void print_degree_stats(const CsrGraph* g, int threads, int k) {
+    int n = g->n;
+    std::vector<long long> local_sum(threads, 0);
+    std::vector<int> local_max(threads, 0);
+    std::vector<std::vector<int> > local_top(threads);
+    long long total = 0;
+    int max_degree = 0;
+
+    if (n <= 0) return;
+    if (k > n) k = n;
+
+    // "a가 b보다 앞" : 차수가 크거나, 같으면 번호가 작음
+    auto before = [g](int a, int b) {
+        int da = degree(g, a), db = degree(g, b);
+        return da != db ? da > db : a < b;
+    };
+
+    // 1) 합계, 최댓값, 상위 k개 후보
+    parallel_for(threads, n, [&](int tid, long long b, long long e) {
+        std::vector<int>& heap = local_top[tid];   // before 기준 최소 힙: 루트가 가장 뒤 순위
+        for (long long v = b; v < e; v++) {
+            int d = degree(g, (int)v);
+            local_sum[tid] += d;
+            if (d > local_max[tid]) local_max[tid] = d;
+
+            if ((int)heap.size() < k) {
+                heap.push_back((int)v);
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+            else if (k > 0 && before((int)v, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), before);
+                heap.back() = (int)v;
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+        }
+    });
+    for (int t = 0; t < threads; t++) {
+        total += local_sum[t];
+        if (local_max[t] > max_degree) max_degree = local_max[t];
+    }
+
+    // 2) 히스토그램
+    std::vector<std::vector<long long> > local_hist(threads);
+    parallel_for(threads, n, [&](int tid, long long b, long long e) {
+        std::vector<long long>& hist = local_hist[tid];
+        if (b < e) hist.assign(max_degree + 1, 0);
+        for (long long v = b; v < e; v++) hist[degree(g, (int)v)]++;
+    });
+    std::vector<long long> hist(max_degree + 1, 0);
+    for (int t = 0; t < threads; t++)
+        for (size_t d = 0; d < local_hist[t].size(); d++) hist[d] += local_hist[t][d];
+
+    printf("\n  degree 통계 : 평균 %.2f, 최대 %d\n", (double)total / n, max_degree);
+    printf("  degree 분포 :");
+    for (int d = 0; d <= max_degree; d++)
+        if (hist[d]) printf("  %d(%lld개)", d, hist[d]);
+    printf("\n");
+
+    // 3) 후보를 모아 상위 k개만 정렬
+    std::vector<int> top;
+    for (int t = 0; t < threads; t++)
+        top.insert(top.end(), local_top[t].begin(), local_top[t].end());
+    std::partial_sort(top.begin(), top.begin() + k, top.end(), before);
+
+    printf("  degree 상위 %d개 :", k);
+    for (int i = 0; i < k; i++)
+        printf("  노드 %d(%d)", top[i], degree(g, top[i]));
+    printf("\n");
+}
+
+/*
+    ===== file_main =====
+    - 간선 파일을 읽어 CSR 을 만들고 단계별 시간과 처리량 출력
+    - out_path 가 있으면 바이너리 간선 파일로 저장 (텍스트 → 바이너리 변환)
+*/
+int file_main(const char* path, const char* out_path, int threads) {
+    CsrGraph g;
+    LoadStats st;
+
+    if (load_edge_file(&g, path, threads, &st) != 0)
+        return 1;
+
+    double total = st.map_sec + st.build_sec;
+    printf("간선 파일 : %s (%.1f MB)\n", path, st.bytes / 1048576.0);
+    printf("  정점 %d개, 간선 %lld개, %s (스레드 %d개)\n",
+           g.n, st.edges, st.undirected ? "무방향" : "방향", threads);
+    printf("  매핑/파싱 %.3f초, CSR 생성 %.3f초\n", st.map_sec, st.build_sec);
+    if (total > 0)
+        printf("  처리량 : %.1f MB/s, %.2f M간선/s\n",
+               st.bytes / 1048576.0 / total, st.edges / 1e6 / total);
+    print_degree_stats(&g, threads, 10);
+
+    if (st.undirected && g.n > 0) {
+        BfsResult r;
+        auto start = std::chrono::steady_clock::now();
+        bfs_parallel(&g, 0, threads, FALSE, &r);
+        printf("  정점 0에서 BFS : 도달 %d개, 레벨 %d개 (%.3f초)\n",
+               r.count, r.top_down_steps + r.bottom_up_steps, seconds_since(start));
+        free_bfs_result(&r);
+    }
+
+    if (out_path) {
+        auto start = std::chrono::steady_clock::now();
+        if (write_edge_file(&g, out_path, st.undirected) != 0) {
+            fprintf(stderr, "%s 기록 실패\n", out_path);
+            free_csr(&g);
+            return 1;
+        }
+        printf("  바이너리 저장 : %s (%.3f초)\n", out_path, seconds_since(start));
+    }
+
+    free_csr(&g);
+    return 0;
+}
+
+/*
+    ===== main =====
+    - 인자 없이 실행하면 10장.cpp 와 같은 대화형 입력/출력 흐름
+    - csr_graph <간선 파일> [바이너리 출력 파일] 로 실행하면 file_main
+*/
+int main(int argc, char** argv) {
+    int n, u, v;
+    EdgeList el;
+    CsrGraph g;
+    Traversal t;
+    int threads = (int)std::thread::hardware_concurrency();
+
+    if (threads < 1) threads = 1;
+    if (argc >= 2)
+        return file_main(argv[1], argc >= 3 ? argv[2] : NULL, threads);
+
+    printf("10.1. CSR 형태의 무방향성 그래프 생성\n");
+    printf("  노드 개수(n): ");
+    if (scanf("%d", &n) != 1 || n <= 0)
+        return 0;
+
+    init_edge_list(&el);
+    while (1) {
+        printf("  에지 정보(vi vj) : ");
+        if (scanf("%d %d", &u, &v) != 2)
+            return 0;
+        if (u == -1 && v == -1)
+            break;
+        if (u < 0 || u >= n || v < 0 || v >= n) {
+            fprintf(stderr, "  정점 번호 오류 (%d, %d)\n", u, v);
+            continue;
+        }
+        add_edge(&el, u, v);
+    }
+
+    build_csr(&g, n, &el, TRUE);
+    free_edge_list(&el);     // CSR을 만든 뒤에는 간선 목록이 필요 없음
+
+    print_graph_and_degree(&g);
+    print_degree_stats(&g, threads, 5);
+    printf("\n");
+
+    init_traversal(&t, &g);
+
+    printf("10.2. 탐색 알고리즘(DFS, BFS)\n");
+    printf("  깊이 우선 탐색 (DFS)\n");
+    for (v = 0; v < n; v += 2) {
+        printf("  시작노드 %d :", v);
+        reset_visited(&t);
+        dfs(&g, &t, v);
+        printf("\n");
+    }
+
+    printf("\n  너비 우선 탐색 (BFS)\n");
+    for (v = 1; v < n; v += 2) {
+        printf("  시작노드 %d :", v);
+        reset_visited(&t);
+        bfs(&g, &t, v);
+        printf("\n");
+    }
+
+    printf("\n10.3. 신장트리 알고리즘\n");
+    printf("  DFS 신장트리\n");
+    for (v = 0; v < n; v += 2) {
+        printf("  시작노드 %d :", v);
+        reset_visited(&t);
+        dfs_spanning(&g, &t, v);
+        printf("\n");
+    }
+
+    printf("\n  BFS 신장트리\n");
+    for (v = 1; v < n; v += 2) {
+        printf("  시작노드 %d :", v);
+        reset_visited(&t);
+        bfs_spanning(&g, &t, v);
+        printf("\n");
+    }
+
+    /*
+        ===== 병렬 방향 최적화 BFS =====
+        - bfs_spanning 과 같은 신장 트리 간선을 같은 순서로 출력
+    */
+    printf("\n10.4. 병렬 방향 최적화 BFS 신장트리 (스레드 %d개)\n", threads);
+    for (v = 1; v < n; v += 2) {
+        BfsResult r;
+        bfs_parallel(&g, v, threads, TRUE, &r);
+
+        printf("  시작노드 %d :", v);
+        for (int i = 1; i < r.count; i++)
+            printf("  (%d, %d)", r.parent[r.order[i]], r.order[i]);
+        printf("\n  (레벨 수 %d, top-down %d단계, bottom-up %d단계)\n",
+               r.top_down_steps + r.bottom_up_steps, r.top_down_steps, r.bottom_up_steps);
+        free_bfs_result(&r);
+    }
+
+    /*
+        ===== 다중 시작 BFS =====
+        - 홀수 정점 전부를 시작 정점으로 한 번에 탐색하고 거리 출력
+    */
+    int k = n / 2;
+    int* sources = (int*)xmalloc(sizeof(int) * k);
+    int* dist = (int*)xmalloc(sizeof(int) * k * n);
+
+    for (int i = 0; i < k; i++) sources[i] = 2 * i + 1;
+    ms_bfs(&g, sources, k, threads, dist);
+
+    printf("\n10.5. 다중 시작 BFS 거리 (시작노드 %d개 동시 탐색)\n", k);
+    for (int i = 0; i < k; i++) {
+        printf("  시작노드 %d :", sources[i]);
+        for (v = 0; v < n; v++)
+            printf("%3d", dist[i * n + v]);
+        printf("\n");
+    }
+    free(sources);
+    free(dist);
+
+    free_traversal(&t);
+    free_csr(&g);
+    return 0;
+}
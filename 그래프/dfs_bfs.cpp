@@ -2,7 +2,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#define MAX_VERTICES 100
 #define FALSE 0
 #define TRUE 1
 
@@ -21,57 +20,58 @@ typedef struct node {
    graph[i] : 정점 i에 인접한 노드들의 연결 리스트의 시작 주소
    visited  : 정점 방문 여부 표시 배열 (DFS, BFS 공용)
    n        : 전체 정점 개수
-   ===================================================== */
-node* graph[MAX_VERTICES];
-short int visited[MAX_VERTICES];
-int n;
-
-/* =====================================================
-   큐 노드 구조체 (BFS에서 사용)
-   vertex : 큐에 저장할 정점 번호
-   link   : 다음 큐 노드를 가리킴
-   ===================================================== */
-typedef struct queue {
-    int vertex;
-    struct queue* link;
-} queue;
-
-/* =====================================================
-   큐에 정점 삽입 (enqueue)
-   front, rear : 큐의 앞과 뒤 포인터의 주소
-   v           : 삽입할 정점 번호
+   capacity : graph / visited 에 할당된 칸 수
    -----------------------------------------------------
-   이중 포인터를 사용하는 이유:
-   → front, rear 자체를 함수 내부에서 변경해야 하기 때문
+   정점 수 제한 없이 실행 중에 필요한 만큼 할당한다.
    ===================================================== */
-void addq(queue** front, queue** rear, int v) {
-    queue* temp = (queue*)malloc(sizeof(queue)); // 새 큐 노드 생성
-    temp->vertex = v;
-    temp->link = NULL;
-
-    if (*rear)                  // 큐가 비어 있지 않다면
-        (*rear)->link = temp;   // 기존 rear 뒤에 연결
-    else                        // 큐가 비어 있다면
-        *front = temp;          // front도 새 노드를 가리킴
+node** graph = NULL;
+short int* visited = NULL;
+int n;
+int capacity = 0;
+
+/*
+    ===== BFS용 배열 큐 =====
+    - 정점 수(capacity) 크기로 미리 할당해 두고 grow_graph 에서 함께 확장
+    - 한 번의 BFS 에서 각 정점은 최대 한 번만 들어가므로
+      front / rear 인덱스만 앞으로 움직이면 넘칠 일이 없음
+    - 예전처럼 정점마다 큐 노드를 calloc / free 하지 않음
+*/
+int* queue = NULL;
+
+/* ===== 큐 연산 (배열 인덱스만 이동, O(1)) ===== */
+void addq(int* rear, int v) {
+    queue[(*rear)++] = v;
+}
 
-    *rear = temp;               // rear를 새 노드로 갱신
+int deleteq(int* front) {
+    return queue[(*front)++];
 }
 
 /* =====================================================
-   큐에서 정점 삭제 (dequeue)
-   -----------------------------------------------------
-   front가 가리키는 노드를 제거하고 그 정점을 반환
+   그래프 배열 확장
+   정점 v까지 담을 수 있도록 graph / visited 를 2배씩 늘림
    ===================================================== */
-int deleteq(queue** front, queue** rear) {
-    queue* temp = *front;       // 삭제할 큐 노드
-    int v = temp->vertex;       // 반환할 정점 번호
+void grow_graph(int v) {
+    int i, new_capacity;
+
+    if (v >= n) n = v + 1;
+    if (v < capacity) return;
 
-    *front = temp->link;        // front를 다음 노드로 이동
-    if (*front == NULL)         // 큐가 비게 되면
-        *rear = NULL;           // rear도 NULL로 설정
+    new_capacity = capacity ? capacity : 16;
+    while (new_capacity <= v) new_capacity *= 2;
 
-    free(temp);                 // 메모리 해제
-    return v;
+    graph = (node**)realloc(graph, sizeof(node*) * new_capacity);
+    visited = (short int*)realloc(visited, sizeof(short int) * new_capacity);
+    queue = (int*)realloc(queue, sizeof(int) * new_capacity);
+    if (!graph || !visited || !queue) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (i = capacity; i < new_capacity; i++) {
+        graph[i] = NULL;
+        visited[i] = FALSE;
+    }
+    capacity = new_capacity;
 }
 
 /* =====================================================
@@ -79,6 +79,8 @@ int deleteq(queue** front, queue** rear) {
    u -> v 방향의 간선을 인접 리스트에 삽입
    ===================================================== */
 void insert_edge(int u, int v) {
+    grow_graph(u > v ? u : v);                 // 필요하면 정점 배열 확장
+
     node* temp = (node*)malloc(sizeof(node)); // 새 그래프 노드 생성
     temp->vertex = v;                          // 연결될 정점 번호
     temp->link = graph[u];                    // 기존 리스트 앞에 연결
@@ -110,20 +112,19 @@ void dfs(int v) {
    ===================================================== */
 void bfs(int v) {
     node* w;
-    queue* front = NULL;
-    queue* rear = NULL;
+    int front = 0, rear = 0;
 
     printf("%5d", v);         // 시작 정점 출력
     visited[v] = TRUE;        // 방문 표시
-    addq(&front, &rear, v);   // 큐에 삽입
+    addq(&rear, v);   // 큐에 삽입
 
-    while (front) {           // 큐가 빌 때까지 반복
-        v = deleteq(&front, &rear);  // 큐에서 정점 하나 꺼냄
+    while (front < rear) {           // 큐가 빌 때까지 반복
+        v = deleteq(&front);  // 큐에서 정점 하나 꺼냄
 
         for (w = graph[v]; w; w = w->link) {
             if (!visited[w->vertex]) {   // 방문하지 않은 인접 정점이면
                 printf("%5d", w->vertex);
-                addq(&front, &rear, w->vertex); // 큐에 삽입
+                addq(&rear, w->vertex); // 큐에 삽입
                 visited[w->vertex] = TRUE;      // 방문 표시
             }
         }
@@ -151,16 +152,17 @@ int main() {
     int u, v;
 
     printf("정점 개수 입력: ");
-    scanf("%d", &n);
+    if (scanf("%d", &n) != 1 || n <= 0)
+        return 0;
 
-    // 인접 리스트 초기화
-    for (int i = 0; i < n; i++)
-        graph[i] = NULL;
+    // 인접 리스트 초기화 (정점 n개 분량 할당)
+    grow_graph(n - 1);
 
     printf("간선 입력 (u v), 종료는 -1 -1\n");
     while (1) {
-        scanf("%d %d", &u, &v);
+        if (scanf("%d %d", &u, &v) != 2) break;
         if (u == -1 && v == -1) break;
+        if (u < 0 || v < 0) continue;
 
         insert_edge(u, v);
         insert_edge(v, u);   // 무방향 그래프이므로 반대 방향도 추가
@@ -1,6 +1,7 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
     ===== 인접 리스트 기반 무방향 그래프 + DFS/BFS 실습 =====
@@ -11,15 +12,18 @@
 
     [구현 기능]
     10.1) 무방향 그래프 생성 + 각 정점의 degree 계산
+          + degree 분포, degree 상위 k개 정점
     10.2) 깊이 우선 탐색(DFS), 너비 우선 탐색(BFS)
     10.3) DFS / BFS 기반 신장 트리(Spanning Tree) 생성
+          + DFS 방문 시각(pre / post order) 출력
 
     [그래프 특성]
     - 무방향 그래프 (insert_edge에서 양방향 삽입)
-    - 최대 정점 수: MAX_VERTICES
+    - 정점 수 제한 없음: graph[], visited[] 는 실행 중에 n에 맞춰 할당하고
+      더 큰 번호의 정점이 들어오면 2배씩 늘림 (grow_graph)
+    - 시작 정점을 바꿀 때마다 visited[] 를 지우지 않고 세대 번호만 올림 (new_visit)
 */
 
-#define MAX_VERTICES 100
 #define FALSE 0
 #define TRUE 1
 
@@ -29,29 +33,111 @@ typedef struct node {
     struct node* link;   // 다음 인접 노드
 } Node;
 
-/* ===== BFS용 큐 노드 ===== */
-typedef struct queue {
-    int vertex;          // 큐에 저장될 정점 번호
-    struct queue* link;  // 다음 큐 노드
-} Queue;
+/*
+    ===== BFS용 배열 큐 =====
+    - 정점 수(capacity) 크기로 미리 할당해 두고 grow_graph 에서 함께 확장
+    - 한 번의 BFS 에서 각 정점은 최대 한 번만 들어가므로
+      front / rear 인덱스만 앞으로 움직이면 넘칠 일이 없음
+    - 예전처럼 정점마다 큐 노드를 calloc / free 하지 않음
+*/
+int* queue = NULL;
+
+/*
+    ===== DFS용 명시적 스택 =====
+    - 재귀 대신 (정점, 다음에 확인할 인접 노드) 쌍을 직접 쌓음
+      → 정점이 수십만 개인 긴 경로 그래프에서도 호출 스택이 넘치지 않음
+    - 각 정점은 스택에 최대 한 번만 들어가므로 capacity 칸이면 충분
+    - queue 와 마찬가지로 grow_graph 에서 함께 확장
+*/
+int* stack_v = NULL;     // 스택에 쌓인 정점
+Node** stack_p = NULL;   // 그 정점에서 다음에 확인할 인접 노드
+
+/*
+    ===== DFS 방문 시각 =====
+    - pre_order[v]  : v를 처음 방문한 시각
+    - post_order[v] : v의 인접 정점을 모두 확인하고 되돌아간 시각
+    - 시각은 방문/종료 때마다 1씩 증가 (0부터 2n-1까지)
+    - u가 v의 조상이면 pre[u] < pre[v] < post[v] < post[u]
+*/
+int* pre_order = NULL;
+int* post_order = NULL;
+int dfs_clock = 0;
 
 /* ===== 전역 변수 ===== */
-Node* graph[MAX_VERTICES];   // 인접 리스트 배열
-short int visited[MAX_VERTICES]; // 방문 여부 배열
-int n;                       // 정점 개수
+Node** graph = NULL;           // 인접 리스트 배열 (capacity 칸)
+unsigned int* visited = NULL;  // 방문한 탐색의 세대 번호 (capacity 칸)
+unsigned int visit_epoch = 1;  // 현재 탐색의 세대 번호
+int* degree = NULL;            // 정점별 차수, insert_edge 에서 바로 갱신 (capacity 칸)
+int n;                         // 정점 개수
+int capacity = 0;              // graph / visited 에 할당된 칸 수
+
+/*
+    ===== grow_graph =====
+    - 정점 v까지 담을 수 있도록 graph / visited 확장
+    - 부족하면 2배씩 늘리므로 정점을 하나씩 추가해도 분할 상환 O(1)
+    - 새로 생긴 칸의 리스트는 NULL
+*/
+void grow_graph(int v) {
+    int i, new_capacity;
+
+    if (v >= n) n = v + 1;
+    if (v < capacity) return;
+
+    new_capacity = capacity ? capacity : 16;
+    while (new_capacity <= v) new_capacity *= 2;
+
+    graph = (Node**)realloc(graph, sizeof(Node*) * new_capacity);
+    visited = (unsigned int*)realloc(visited, sizeof(unsigned int) * new_capacity);
+    queue = (int*)realloc(queue, sizeof(int) * new_capacity);
+    stack_v = (int*)realloc(stack_v, sizeof(int) * new_capacity);
+    stack_p = (Node**)realloc(stack_p, sizeof(Node*) * new_capacity);
+    pre_order = (int*)realloc(pre_order, sizeof(int) * new_capacity);
+    post_order = (int*)realloc(post_order, sizeof(int) * new_capacity);
+    degree = (int*)realloc(degree, sizeof(int) * new_capacity);
+    if (!graph || !visited || !queue || !stack_v || !stack_p || !pre_order || !post_order || !degree) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (i = capacity; i < new_capacity; i++) {
+        graph[i] = NULL;
+        visited[i] = 0;   // 어느 세대에도 방문하지 않음
+        degree[i] = 0;
+    }
+    capacity = new_capacity;
+}
 
 /*
     ===== init_graph =====
     - 그래프 초기화
-    - 각 정점의 인접 리스트를 NULL로 설정
+    - 정점 n개 분량의 배열을 할당하고 각 정점의 인접 리스트를 NULL로 설정
 */
 void init_graph(int n) {
-    int i;
-    for (i = 0; i < n; i++) {
-        graph[i] = NULL;
+    if (n > 0) grow_graph(n - 1);
+}
+
+/*
+    ===== 방문 표시 (세대 번호 방식) =====
+    - visited[v] 에 TRUE/FALSE 대신 "v를 방문한 탐색의 세대 번호"를 저장
+    - visited[v] == visit_epoch 이면 이번 탐색에서 방문한 정점
+    - 새 탐색을 시작할 때 visit_epoch 만 1 증가시키면
+      이전 표시가 모두 무효가 되므로 배열을 지울 필요가 없음 → O(1) 초기화
+    - 세대 번호가 한 바퀴 돌아 0이 되면 (2^32번에 한 번) 그때만 배열 전체를 지움
+*/
+void new_visit(void) {
+    if (++visit_epoch == 0) {
+        memset(visited, 0, sizeof(unsigned int) * capacity);
+        visit_epoch = 1;
     }
 }
 
+int is_visited(int v) {
+    return visited[v] == visit_epoch;
+}
+
+void mark_visited(int v) {
+    visited[v] = visit_epoch;
+}
+
 /*
     ===== insert_edge =====
     - 무방향 그래프에서 간선 (u, v) 삽입
@@ -61,10 +147,14 @@ void init_graph(int n) {
     2) v → u 삽입
 
     → 무방향 그래프이므로 양쪽 모두 연결
+    → n 이상인 정점 번호가 들어오면 그래프를 늘림
+    → 양 끝 정점의 degree 를 1씩 증가 (리스트를 다시 셀 필요 없음)
 */
 void insert_edge(int u, int v) {
     Node* p;
 
+    grow_graph(u > v ? u : v);
+
     // u의 인접 리스트에 v 추가
     p = (Node*)calloc(1, sizeof(Node));
     p->vertex = v;
@@ -76,72 +166,53 @@ void insert_edge(int u, int v) {
     p->vertex = u;
     p->link = graph[v];
     graph[v] = p;
+
+    degree[u]++;
+    degree[v]++;
 }
 
 /*
     ===== addq =====
     - BFS를 위한 큐 삽입(enqueue)
-
-    front, rear를 이중 포인터로 받는 이유:
-    - 큐가 비어 있을 때 front와 rear를 동시에 변경해야 하기 때문
+    - rear 위치에 넣고 rear를 한 칸 이동 (메모리 할당 없음)
 */
-void addq(Queue** front, Queue** rear, int v) {
-    Queue* temp = (Queue*)calloc(1, sizeof(Queue));
-    temp->vertex = v;
-    temp->link = NULL;
-
-    if (*rear) {
-        (*rear)->link = temp;
-    }
-    else {
-        *front = temp;
-    }
-    *rear = temp;
+void addq(int* rear, int v) {
+    queue[(*rear)++] = v;
 }
 
 /*
     ===== deleteq =====
     - BFS를 위한 큐 삭제(dequeue)
+    - front 위치의 정점을 꺼내고 front를 한 칸 이동
 
     반환값:
     - 큐에서 제거된 정점 번호
 */
-int deleteq(Queue** front, Queue** rear) {
-    Queue* temp = *front;
-    int v = temp->vertex;
-
-    *front = temp->link;
-    if (*front == NULL)
-        *rear = NULL;
-
-    free(temp);
-    return v;
+int deleteq(int* front) {
+    return queue[(*front)++];
 }
 
 /*
     ===== print_graph_and_degree =====
     - 인접 리스트 출력
-    - 각 정점의 degree(차수) 계산
+    - 각 정점의 degree(차수) 는 insert_edge 에서 미리 세어 둔 값 사용
     - degree가 가장 큰 정점 출력
 */
 void print_graph_and_degree(void) {
-    int i, degree, max_degree = -1, max_vertex = -1;
+    int i, max_degree = -1, max_vertex = -1;
     Node* p;
 
     printf("\n  인접 리스트를 이용하여 구성한 그래프\n");
     for (i = 0; i < n; i++) {
         printf("   [%d]:", i);
-        degree = 0;
-
         for (p = graph[i]; p != NULL; p = p->link) {
             printf("  %d ->", p->vertex);
-            degree++;  // 인접 노드 수 = degree
         }
         printf(" end\n");
 
         // 최대 degree 정점 갱신
-        if (degree > max_degree) {
-            max_degree = degree;
+        if (degree[i] > max_degree) {
+            max_degree = degree[i];
             max_vertex = i;
         }
     }
@@ -157,27 +228,162 @@ void print_graph_and_degree(void) {
 }
 
 /*
-    ===== dfs (깊이 우선 탐색) =====
-    - 재귀 호출 방식
-    - 방문한 정점을 즉시 출력
+    ===== degree 통계 =====
+    - 리스트를 다시 훑지 않고 degree[] 만 사용 → O(V)
 
-    알고리즘:
-    1) 현재 정점 방문 표시
-    2) 인접한 정점 중 방문하지 않은 정점으로 재귀 이동
+    [히스토그램]
+    - hist[d] : degree 가 d 인 정점 수 (d = 0 ~ 최대 degree)
+
+    [상위 k개 정점 (부분 정렬)]
+    - 크기 k의 최소 힙에 지금까지 가장 큰 k개를 유지
+    - 새 정점이 힙의 최솟값(루트)보다 크면 루트와 바꾸고 아래로 내림
+    - 전체 정렬 O(V log V) 대신 O(V log k)
+    - 같은 degree 면 번호가 작은 정점을 더 큰 것으로 봄
 */
-void dfs(int v) {
+
+/* a가 b보다 "작은" 정점이면 TRUE (degree 가 작거나, 같으면 번호가 큼) */
+int degree_less(int a, int b) {
+    if (degree[a] != degree[b]) return degree[a] < degree[b];
+    return a > b;
+}
+
+/* 최소 힙의 루트 자리에서 아래로 내리기 */
+void heap_down(int* heap, int size, int i) {
+    int child, tmp;
+
+    while ((child = 2 * i + 1) < size) {
+        if (child + 1 < size && degree_less(heap[child + 1], heap[child])) child++;
+        if (!degree_less(heap[child], heap[i])) break;
+        tmp = heap[i];
+        heap[i] = heap[child];
+        heap[child] = tmp;
+        i = child;
+    }
+}
+
+/* 최소 힙에 삽입 (위로 올리기) */
+void heap_up(int* heap, int i) {
+    int parent, tmp;
+
+    while (i > 0 && degree_less(heap[i], heap[parent = (i - 1) / 2])) {
+        tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+void print_degree_stats(int k) {
+    int i, size = 0, max_degree = 0;
+    long long total = 0;
+    int* hist;
+    int* heap;
+
+    if (n <= 0) return;
+    for (i = 0; i < n; i++) {
+        total += degree[i];
+        if (degree[i] > max_degree) max_degree = degree[i];
+    }
+
+    // 히스토그램
+    hist = (int*)calloc(max_degree + 1, sizeof(int));
+    for (i = 0; i < n; i++) hist[degree[i]]++;
+
+    printf("\n  degree 통계 : 평균 %.2f, 최대 %d\n", (double)total / n, max_degree);
+    printf("  degree 분포 :");
+    for (i = 0; i <= max_degree; i++) {
+        if (hist[i]) printf("  %d(%d개)", i, hist[i]);
+    }
+    printf("\n");
+    free(hist);
+
+    // 상위 k개
+    if (k > n) k = n;
+    heap = (int*)malloc(sizeof(int) * (k > 0 ? k : 1));
+    for (i = 0; i < n; i++) {
+        if (size < k) {
+            heap[size] = i;
+            heap_up(heap, size++);
+        }
+        else if (k > 0 && degree_less(heap[0], i)) {
+            heap[0] = i;
+            heap_down(heap, size, 0);
+        }
+    }
+
+    // 힙에서 최솟값부터 꺼내 뒤에서부터 채우면 큰 순서로 정렬됨
+    while (size > 1) {
+        int tmp = heap[0];
+        heap[0] = heap[--size];
+        heap[size] = tmp;
+        heap_down(heap, size, 0);
+    }
+    printf("  degree 상위 %d개 :", k);
+    for (i = 0; i < k; i++)
+        printf("  노드 %d(%d)", heap[i], degree[heap[i]]);
+    printf("\n");
+    free(heap);
+}
+
+/*
+    ===== dfs_common =====
+    - 명시적 스택을 이용한 반복 DFS
+    - 스택 맨 위 (v, p) 에서 p부터 방문하지 않은 인접 정점을 찾아
+      있으면 그 정점을 쌓고, 없으면 v를 꺼냄 (재귀 호출의 복귀와 같음)
+    - p를 스택에 남겨 두므로 되돌아왔을 때 이어서 확인
+      → 재귀 DFS와 방문 순서, 신장 트리 간선이 완전히 같다.
+    - pre_order / post_order 에 방문 시각 기록
+
+    print_edges:
+    - FALSE : 방문한 정점 출력 (dfs)
+    - TRUE  : 신장 트리 간선 (부모, 자식) 출력 (dfs_spanning)
+*/
+void dfs_common(int start, int print_edges) {
+    int top = 0, v;
     Node* w;
 
-    visited[v] = TRUE;
-    printf("%5d", v);
+    dfs_clock = 0;
+    mark_visited(start);
+    pre_order[start] = dfs_clock++;
+    if (!print_edges) printf("%5d", start);
+    stack_v[top] = start;
+    stack_p[top++] = graph[start];
+
+    while (top) {
+        v = stack_v[top - 1];
 
-    for (w = graph[v]; w; w = w->link) {
-        if (!visited[w->vertex]) {
-            dfs(w->vertex);
+        // 아직 방문하지 않은 다음 인접 정점 찾기
+        for (w = stack_p[top - 1]; w && is_visited(w->vertex); w = w->link);
+
+        if (!w) {   // 인접 정점을 모두 확인 → 되돌아감
+            post_order[v] = dfs_clock++;
+            top--;
+            continue;
         }
+
+        stack_p[top - 1] = w->link;   // 돌아왔을 때 이어서 볼 위치
+        mark_visited(w->vertex);
+        pre_order[w->vertex] = dfs_clock++;
+        if (print_edges) printf("  (%d, %d)", v, w->vertex);
+        else printf("%5d", w->vertex);
+        stack_v[top] = w->vertex;
+        stack_p[top++] = graph[w->vertex];
     }
 }
 
+/*
+    ===== dfs (깊이 우선 탐색) =====
+    - 명시적 스택 방식 (dfs_common)
+    - 방문한 정점을 즉시 출력
+
+    알고리즘:
+    1) 현재 정점 방문 표시
+    2) 인접한 정점 중 방문하지 않은 정점으로 이동, 없으면 되돌아감
+*/
+void dfs(int v) {
+    dfs_common(v, FALSE);
+}
+
 /*
     ===== bfs (너비 우선 탐색) =====
     - 큐를 이용한 반복 구조
@@ -190,20 +396,20 @@ void dfs(int v) {
 */
 void bfs(int v) {
     Node* w;
-    Queue* front = NULL, * rear = NULL;
+    int front = 0, rear = 0;
 
-    visited[v] = TRUE;
+    mark_visited(v);
     printf("%5d", v);
-    addq(&front, &rear, v);
+    addq(&rear, v);
 
-    while (front) {
-        v = deleteq(&front, &rear);
+    while (front < rear) {
+        v = deleteq(&front);
 
         for (w = graph[v]; w; w = w->link) {
-            if (!visited[w->vertex]) {
-                visited[w->vertex] = TRUE;
+            if (!is_visited(w->vertex)) {
+                mark_visited(w->vertex);
                 printf("%5d", w->vertex);
-                addq(&front, &rear, w->vertex);
+                addq(&rear, w->vertex);
             }
         }
     }
@@ -218,15 +424,7 @@ void bfs(int v) {
     - 연결 그래프일 경우 (n - 1)개
 */
 void dfs_spanning(int v) {
-    Node* w;
-
-    visited[v] = TRUE;
-    for (w = graph[v]; w; w = w->link) {
-        if (!visited[w->vertex]) {
-            printf("  (%d, %d)", v, w->vertex);
-            dfs_spanning(w->vertex);
-        }
-    }
+    dfs_common(v, TRUE);
 }
 
 /*
@@ -236,19 +434,19 @@ void dfs_spanning(int v) {
 */
 void bfs_spanning(int v) {
     Node* w;
-    Queue* front = NULL, * rear = NULL;
+    int front = 0, rear = 0;
 
-    visited[v] = TRUE;
-    addq(&front, &rear, v);
+    mark_visited(v);
+    addq(&rear, v);
 
-    while (front) {
-        v = deleteq(&front, &rear);
+    while (front < rear) {
+        v = deleteq(&front);
 
         for (w = graph[v]; w; w = w->link) {
-            if (!visited[w->vertex]) {
-                visited[w->vertex] = TRUE;
+            if (!is_visited(w->vertex)) {
+                mark_visited(w->vertex);
                 printf("  (%d, %d)", v, w->vertex);
-                addq(&front, &rear, w->vertex);
+                addq(&rear, w->vertex);
             }
         }
     }
@@ -271,6 +469,24 @@ void free_graph(void) {
         }
         graph[i] = NULL;
     }
+    free(graph);
+    free(visited);
+    free(queue);
+    free(stack_v);
+    free(stack_p);
+    free(pre_order);
+    free(post_order);
+    free(degree);
+    graph = NULL;
+    visited = NULL;
+    queue = NULL;
+    stack_v = NULL;
+    stack_p = NULL;
+    pre_order = NULL;
+    post_order = NULL;
+    degree = NULL;
+    n = capacity = 0;
+    visit_epoch = 1;
 }
 
 /*
@@ -282,7 +498,7 @@ int main(void) {
 
     printf("10.1. 인접 리스트 형태의 무방향성 그래프 생성\n");
     printf("  노드 개수(n): ");
-    if (scanf("%d", &n) != 1)
+    if (scanf("%d", &n) != 1 || n <= 0)
         return 0;
 
     init_graph(n);
@@ -294,10 +510,15 @@ int main(void) {
             return 0;
         if (u == -1 && v == -1)
             break;
+        if (u < 0 || v < 0) {
+            fprintf(stderr, "  정점 번호 오류 (%d, %d)\n", u, v);
+            continue;
+        }
         insert_edge(u, v);
     }
 
     print_graph_and_degree();
+    print_degree_stats(5);
     printf("\n");
 
     /*
@@ -308,7 +529,7 @@ int main(void) {
     printf("  깊이 우선 탐색 (DFS)\n");
     for (v = 0; v < n; v += 2) {
         printf("  시작노드 %d :", v);
-        for (i = 0; i < n; i++) visited[i] = FALSE;
+        new_visit();
         dfs(v);
         printf("\n");
     }
@@ -320,7 +541,7 @@ int main(void) {
     printf("\n  너비 우선 탐색 (BFS)\n");
     for (v = 1; v < n; v += 2) {
         printf("  시작노드 %d :", v);
-        for (i = 0; i < n; i++) visited[i] = FALSE;
+        new_visit();
         bfs(v);
         printf("\n");
     }
@@ -332,11 +553,26 @@ int main(void) {
     printf("  DFS 신장트리\n");
     for (v = 0; v < n; v += 2) {
         printf("  시작노드 %d :", v);
-        for (i = 0; i < n; i++) visited[i] = FALSE;
+        new_visit();
         dfs_spanning(v);
         printf("\n");
     }
 
+    /*
+        ===== DFS 방문 시각 =====
+        - 시작 노드 0에서 DFS 한 뒤 각 정점의 (pre, post) 출력
+        - 0과 연결되지 않은 정점은 방문하지 않았으므로 생략
+    */
+    printf("\n  DFS 방문 시각 (pre, post)\n");
+    printf("  시작노드 0 :");
+    new_visit();
+    dfs(0);
+    printf("\n");
+    for (i = 0; i < n; i++) {
+        if (is_visited(i))
+            printf("   [%d]: (%d, %d)\n", i, pre_order[i], post_order[i]);
+    }
+
     free_graph();
     return 0;
 }
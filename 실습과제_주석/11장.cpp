@@ -1,11 +1,20 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <thread>
+#include <vector>
+#include <queue>
+#include <functional>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
-#define MAX_VERTICES 100
 #define FALSE 0
 #define TRUE 1
-#define INT_MAX 99999   // 무한대(연결되지 않음을 표현)
+#define NO_EDGE INT_MAX         // 간선 없음 (실제 가중치와 겹치지 않도록 int 최댓값)
+#define UNREACHABLE LLONG_MAX   // 도달할 수 없는 정점의 거리
 
 /*
     ===== 인접 행렬 기반 방향 그래프 + 최단 경로 알고리즘 =====
@@ -13,39 +22,101 @@
     [그래프 표현]
     - 인접 행렬(adj_mat)
     - adj_mat[i][j] = i → j 로 가는 가중치
-    - 연결되지 않은 경우 INT_MAX
+    - 연결되지 않은 경우 NO_EDGE
     - 자기 자신(i == j)은 비용 0
 
+    [거리 표현]
+    - 예전에는 INT_MAX 를 99999 로 다시 정의해 "무한대"로 썼기 때문에
+      가중치가 크면 실제 거리와 무한대가 겹치거나 덧셈이 넘칠 수 있었다.
+    - 간선 없음은 NO_EDGE, 도달 불가는 UNREACHABLE 로 따로 표현하고
+      Dijkstra 거리는 64비트(long long), Floyd-Warshall 은 포화 덧셈을 사용
+
     [구현 알고리즘]
     11.1) 인접 행렬 형태의 방향 그래프 생성
     11.2) 단일 출발점 최단 경로 (Dijkstra)
-    11.3) 모든 쌍 최단 경로 (Floyd-Warshall)
+    11.3) 모든 쌍 최단 경로 (Floyd-Warshall, 타일 분할 + SIMD + 스레드)
+    11.4) 경로 복원
+    11.5) 동적 갱신 (간선 삽입 / 가중치 감소를 기존 결과에 바로 반영)
 */
 
 /* ===== 그래프 구조체 ===== */
 typedef struct GraphType {
-    int n;   // 정점 개수
-    int adj_mat[MAX_VERTICES][MAX_VERTICES]; // 인접 행렬
+    int n;          // 정점 개수
+    int capacity;   // adj_mat 에 할당된 행(열) 수
+    int** adj_mat;  // 인접 행렬 (capacity x capacity, 처음 정점이 들어올 때 할당)
 } GraphType;
 
 /*
     ===== init =====
     - 그래프 초기화
     - 정점 개수 n = 0
-    - 자기 자신으로 가는 비용은 0
-    - 나머지는 INT_MAX로 초기화
+    - 행렬은 정점이 처음 추가될 때 grow에서 할당
 */
 void init(GraphType* g) {
-    int r, c;
     g->n = 0;
+    g->capacity = 0;
+    g->adj_mat = NULL;
+}
+
+/*
+    ===== alloc_matrix / free_matrix =====
+    - rows x rows 정수 행렬을 한 덩어리로 할당하고 행 포인터 배열을 붙임
+      → m[i][j] 문법 그대로 사용 가능
+*/
+int** alloc_matrix(int rows) {
+    size_t cells = (size_t)rows * rows;
+    int** m = (int**)malloc(sizeof(int*) * (rows > 0 ? rows : 1));
+    int* block = (int*)malloc(sizeof(int) * (cells > 0 ? cells : 1));
+    if (!m || !block) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    m[0] = block;   // rows == 0 이어도 free_matrix 가 block을 해제할 수 있도록
+    for (int i = 1; i < rows; i++)
+        m[i] = block + (size_t)i * rows;
+    return m;
+}
+
+void free_matrix(int** m) {
+    if (m) {
+        free(m[0]);
+        free(m);
+    }
+}
+
+/*
+    ===== grow =====
+    - 행렬을 최소 need 행까지 2배씩 늘리고 기존 값 복사
+    - 새로 생긴 칸: 자기 자신으로 가는 비용은 0, 나머지는 NO_EDGE
+*/
+void grow(GraphType* g, int need) {
+    int r, c, new_capacity;
+    int** m;
+
+    if (need <= g->capacity) return;
+
+    new_capacity = g->capacity ? g->capacity : 16;
+    while (new_capacity < need) new_capacity *= 2;
 
-    for (r = 0; r < MAX_VERTICES; r++)
-        for (c = 0; c < MAX_VERTICES; c++) {
-            if (r == c)
-                g->adj_mat[r][c] = 0;
+    m = alloc_matrix(new_capacity);
+    for (r = 0; r < new_capacity; r++)
+        for (c = 0; c < new_capacity; c++) {
+            if (r < g->capacity && c < g->capacity)
+                m[r][c] = g->adj_mat[r][c];
+            else if (r == c)
+                m[r][c] = 0;
             else
-                g->adj_mat[r][c] = INT_MAX;
+                m[r][c] = NO_EDGE;
         }
+
+    free_matrix(g->adj_mat);
+    g->adj_mat = m;
+    g->capacity = new_capacity;
+}
+
+void free_graph(GraphType* g) {
+    free_matrix(g->adj_mat);
+    init(g);
 }
 
 /*
@@ -58,13 +129,14 @@ void init(GraphType* g) {
     found[]    : 이미 최단 거리가 확정된 정점 여부
 
     반환값:
-    - 선택된 정점 번호(minpos)
+    - 선택된 정점 번호(minpos), 남은 정점이 모두 도달 불가면 -1
 */
-int choose(int distance[], int n, short int found[])
+int choose(long long distance[], int n, short int found[])
 {
-    int i, min, minpos;
+    int i, minpos;
+    long long min;
 
-    min = INT_MAX;
+    min = UNREACHABLE;
     minpos = -1;
 
     for (i = 0; i < n; i++)
@@ -89,7 +161,8 @@ void print_adj_mat(GraphType* g) {
     for (int i = 0; i < g->n; i++) {
         printf("[%2d]\t", i);
         for (int j = 0; j < g->n; j++) {
-            printf("%d\t", g->adj_mat[i][j]);
+            if (g->adj_mat[i][j] == NO_EDGE) printf("INF\t");
+            else printf("%d\t", g->adj_mat[i][j]);
         }
         printf("\n");
     }
@@ -100,68 +173,604 @@ void print_adj_mat(GraphType* g) {
     - 단일 출발점 최단 경로 계산
 
     v        : 시작 정점
-    cost[][] : 인접 행렬 (가중치)
-    distance[] : 시작 정점으로부터의 최단 거리 결과
+    cost[][] : 인접 행렬 (가중치, 간선 없음은 NO_EDGE)
+    distance[] : 시작 정점으로부터의 최단 거리 결과 (도달 불가는 UNREACHABLE)
     found[]    : 최단 거리 확정 여부
+    pred[]     : 최단 경로에서 바로 앞 정점 (시작 정점과 도달 불가는 -1)
+                 → sssp_route 로 경로 복원, 필요 없으면 NULL
 
     알고리즘 흐름:
     1) 시작 정점 v에서 직접 갈 수 있는 거리로 distance 초기화
     2) 가장 가까운 미방문 정점 u 선택
     3) u를 거쳐 다른 정점으로 가는 경로가 더 짧으면 distance 갱신
+    4) 모든 정점이 확정되거나 남은 정점이 도달 불가일 때까지 반복
+       (예전에는 n - 2 번만 반복)
+
+    반환값:
+    - 0 : 성공
+    - -1 : 시작 정점 번호 오류 또는 음수 가중치 (Dijkstra 로는 구할 수 없음)
+           음수 가중치 그래프는 자구실/존슨_최단경로.cpp 의 Bellman-Ford / Johnson 사용
 */
-void shortestPath(int v, int cost[][MAX_VERTICES],
-                  int distance[], int n, short int found[])
+int shortestPath(int v, int** cost, long long distance[], int n,
+                 short int found[], int pred[])
 {
     int i, u, w;
 
+    if (v < 0 || v >= n) {
+        fprintf(stderr, "정점 번호 오류 (%d)\n", v);
+        return -1;
+    }
+    for (u = 0; u < n; u++)
+        for (w = 0; w < n; w++)
+            if (cost[u][w] != NO_EDGE && cost[u][w] < 0) {
+                fprintf(stderr, "음수 가중치 (%d -> %d, %d) : Dijkstra 를 쓸 수 없음\n",
+                        u, w, cost[u][w]);
+                return -1;
+            }
+
     // 초기화
     for (i = 0; i < n; i++) {
         found[i] = FALSE;
-        distance[i] = cost[v][i];
+        distance[i] = cost[v][i] == NO_EDGE ? UNREACHABLE : cost[v][i];
+        if (pred) pred[i] = cost[v][i] == NO_EDGE ? -1 : v;
     }
 
     found[v] = TRUE;
     distance[v] = 0;
+    if (pred) pred[v] = -1;
 
-    // 정점 수 - 2 번 반복
-    for (i = 0; i < n - 2; i++) {
+    // 시작 정점을 뺀 나머지 정점 수만큼 반복
+    for (i = 0; i < n - 1; i++) {
         u = choose(distance, n, found);
+        if (u == -1) break;   // 남은 정점은 도달 불가
         found[u] = TRUE;
 
         for (w = 0; w < n; w++)
-            if (!found[w])
-                if (distance[u] + cost[u][w] < distance[w])
+            if (!found[w] && cost[u][w] != NO_EDGE)
+                if (distance[u] + cost[u][w] < distance[w]) {   // 64비트 덧셈: 넘치지 않음
                     distance[w] = distance[u] + cost[u][w];
+                    if (pred) pred[w] = u;
+                }
     }
+    return 0;
+}
+
+/*
+    ===== reference_sssp (검증용 기준 구현) =====
+    - Bellman-Ford : 모든 간선을 n - 1 번 완화 (한 번도 바뀌지 않으면 조기 종료)
+    - O(V^3) 로 느리지만 단순해서 틀리기 어렵고 음수 가중치도 처리
+    - 반환값 : 0 성공, -1 시작 정점에서 닿는 음수 사이클 존재
+*/
+int reference_sssp(int v, int** cost, long long distance[], int n)
+{
+    int i, u, w, changed;
+
+    for (i = 0; i < n; i++) distance[i] = UNREACHABLE;
+    distance[v] = 0;
+
+    for (i = 0; i < n; i++) {
+        changed = FALSE;
+        for (u = 0; u < n; u++) {
+            if (distance[u] == UNREACHABLE) continue;
+            for (w = 0; w < n; w++)
+                if (u != w && cost[u][w] != NO_EDGE && distance[u] + cost[u][w] < distance[w]) {
+                    distance[w] = distance[u] + cost[u][w];
+                    changed = TRUE;
+                }
+        }
+        if (!changed) return 0;
+    }
+    return -1;  // n 번째에도 줄어들면 음수 사이클
+}
+
+/*
+    ===== check_sssp (교차 검증) =====
+    - distance 를 reference_sssp 결과와 비교
+    - pred 가 올바른 최단 경로 트리인지 확인
+        pred[w] → w 간선이 있고, distance[pred[w]] + cost == distance[w]
+    - 반환값 : 발견한 오류 개수 (0이면 통과)
+*/
+int check_sssp(int v, int** cost, const long long distance[], const int pred[], int n)
+{
+    long long* ref = (long long*)malloc(sizeof(long long) * (n + 1));
+    int w, errors = 0;
+
+    if (reference_sssp(v, cost, ref, n) != 0) {
+        printf("  검증 : 음수 사이클이 있어 최단 거리가 정의되지 않음\n");
+        free(ref);
+        return 1;
+    }
+
+    for (w = 0; w < n; w++) {
+        if (distance[w] != ref[w]) {
+            printf("  검증 오류 : 정점 %d 거리 %lld, 기준값 %lld\n", w, distance[w], ref[w]);
+            errors++;
+            continue;
+        }
+        if (w == v || distance[w] == UNREACHABLE) {
+            if (pred[w] != -1) {
+                printf("  검증 오류 : 정점 %d 에 선행 정점이 있으면 안 됨\n", w);
+                errors++;
+            }
+            continue;
+        }
+        int p = pred[w];
+        if (p < 0 || p >= n || cost[p][w] == NO_EDGE || distance[p] == UNREACHABLE ||
+            distance[p] + cost[p][w] != distance[w]) {
+            printf("  검증 오류 : 정점 %d 의 선행 정점 %d 이 최단 경로가 아님\n", w, p);
+            errors++;
+        }
+    }
+
+    free(ref);
+    return errors;
+}
+
+/*
+    ===== print_distance =====
+    - 도달 불가는 INF 로 출력
+*/
+void print_distance(const long long distance[], int n)
+{
+    printf("Distance : ");
+    for (int i = 0; i < n; i++) {
+        if (distance[i] == UNREACHABLE) printf("INF ");
+        else printf("%3lld ", distance[i]);
+    }
+    printf("\n");
 }
 
 /*
-    ===== allCosts (Floyd-Warshall 알고리즘) =====
+    ===== NextHop (경로 복원용 다음 정점 행렬) =====
+    - hop(i, j) : i 에서 j 로 가는 최단 경로에서 i 다음에 밟는 정점
+                  (경로가 없으면 -1)
+    - Floyd-Warshall 에서 i → k → j 가 더 짧아지면 hop(i, j) = hop(i, k)
+      → i 에서 hop 을 따라가면 경로 길이만큼의 시간에 경로 전체를 얻음
+    - 정점이 65535 개 미만이면 칸당 16비트, 그 이상이면 32비트로 저장
+      (빈 칸 표시는 각 폭의 최댓값)
+*/
+#define HOP16_LIMIT 0xFFFF
+
+typedef struct NextHop {
+    int n;
+    int wide;                   // FALSE : hop16 사용, TRUE : hop32 사용
+    unsigned short* hop16;
+    unsigned int* hop32;
+} NextHop;
+
+void init_next_hop(NextHop* nh, int n) {
+    size_t cells = (size_t)n * n;
+    nh->n = n;
+    nh->wide = n >= HOP16_LIMIT;
+    nh->hop16 = NULL;
+    nh->hop32 = NULL;
+    if (nh->wide) nh->hop32 = (unsigned int*)malloc(sizeof(unsigned int) * (cells ? cells : 1));
+    else nh->hop16 = (unsigned short*)malloc(sizeof(unsigned short) * (cells ? cells : 1));
+    if (!nh->hop16 && !nh->hop32) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+}
+
+void free_next_hop(NextHop* nh) {
+    free(nh->hop16);
+    free(nh->hop32);
+    nh->hop16 = NULL;
+    nh->hop32 = NULL;
+    nh->n = 0;
+}
+
+int next_hop(const NextHop* nh, int i, int j) {
+    size_t k = (size_t)i * nh->n + j;
+    if (nh->wide) return nh->hop32[k] == 0xFFFFFFFFu ? -1 : (int)nh->hop32[k];
+    return nh->hop16[k] == HOP16_LIMIT ? -1 : nh->hop16[k];
+}
+
+void set_next_hop(NextHop* nh, int i, int j, int v) {
+    size_t k = (size_t)i * nh->n + j;
+    if (nh->wide) nh->hop32[k] = v < 0 ? 0xFFFFFFFFu : (unsigned int)v;
+    else nh->hop16[k] = v < 0 ? HOP16_LIMIT : (unsigned short)v;
+}
+
+/*
+    ===== route (모든 쌍 결과에서 경로 복원) =====
+    - path[] 에 from, ..., to 순서로 정점을 채우고 정점 수를 반환
+    - 경로가 없거나 다음 정점 표가 끊기거나 순환하여 n 칸 안에 to 에 닿지 못하면 0, O(경로 길이)
+    - path 는 정점 수(n) 칸이면 충분 (최단 경로는 같은 정점을 두 번 지나지 않음)
+*/
+int route(const NextHop* nh, int from, int to, int* path) {
+    int count = 0;
+
+    path[count++] = from;
+    while (from != to) {
+        if (count >= nh->n) return 0;   // n 칸을 다 썼는데 to 가 아님 → 순환
+        from = next_hop(nh, from, to);
+        if (from == -1) return 0;
+        path[count++] = from;
+    }
+    return count;
+}
+
+/*
+    ===== sssp_route (단일 출발점 결과에서 경로 복원) =====
+    - shortestPath 의 pred[] 를 to 에서 거꾸로 따라간 뒤 뒤집음, O(경로 길이)
+    - 반환값 : path 에 채운 정점 수 (start 에서 닿지 않으면 0)
+*/
+int sssp_route(const int pred[], int start, int to, int* path) {
+    int count = 0;
+
+    if (to != start && pred[to] == -1) return 0;
+    for (int v = to; v != -1; v = v == start ? -1 : pred[v])
+        path[count++] = v;
+    for (int i = 0, j = count - 1; i < j; i++, j--) {
+        int t = path[i];
+        path[i] = path[j];
+        path[j] = t;
+    }
+    return count;
+}
+
+/*
+    ===== all_costs_reference (Floyd-Warshall 기본형) =====
     - 모든 정점 쌍 간 최단 경로 계산
 
     distance[i][j] :
-    - i에서 j로 가는 최단 경로 비용
+    - i에서 j로 가는 최단 경로 비용 (도달 불가는 NO_EDGE)
 
     핵심 아이디어:
     - k를 중간 정점으로 사용했을 때
       i → k → j 경로가 더 짧으면 갱신
+    - NO_EDGE 를 거치는 경로는 건너뛰고, 합은 64비트로 계산한 뒤
+      NO_EDGE 이상이면 NO_EDGE - 1 로 포화 (도달 불가와 겹치지 않도록)
+    - 가중치가 매우 커서 allCosts 의 빠른 경로를 쓸 수 없을 때와 검증에 사용
+    - next 가 NULL 이 아니면 다음 정점 행렬도 채움
 */
-void allCosts(int cost[][MAX_VERTICES],
-              int distance[][MAX_VERTICES], int n)
+void all_costs_reference(int** cost, int** distance, int n, NextHop* next)
 {
     int i, j, k;
 
-    // 초기 distance = cost
+    // 초기 distance = cost, 간선이 있으면 다음 정점은 도착 정점
     for (i = 0; i < n; i++)
-        for (j = 0; j < n; j++)
+        for (j = 0; j < n; j++) {
             distance[i][j] = cost[i][j];
+            if (next) set_next_hop(next, i, j, i == j || cost[i][j] != NO_EDGE ? j : -1);
+        }
 
     // Floyd-Warshall
     for (k = 0; k < n; k++)
-        for (i = 0; i < n; i++)
-            for (j = 0; j < n; j++)
-                if (distance[i][k] + distance[k][j] < distance[i][j])
-                    distance[i][j] = distance[i][k] + distance[k][j];
+        for (i = 0; i < n; i++) {
+            if (distance[i][k] == NO_EDGE) continue;
+            for (j = 0; j < n; j++) {
+                if (distance[k][j] == NO_EDGE) continue;
+                long long sum = (long long)distance[i][k] + distance[k][j];
+                if (sum >= NO_EDGE) sum = NO_EDGE - 1;
+                if (sum < distance[i][j]) {
+                    distance[i][j] = (int)sum;
+                    if (next) set_next_hop(next, i, j, next_hop(next, i, k));
+                }
+            }
+        }
+}
+
+/*
+    ===== 타일 분할(blocked) Floyd-Warshall =====
+
+    [기본형의 문제]
+    - k 마다 n x n 행렬 전체를 훑음 → n 이 수천이면 행렬이 캐시에 들어가지 않아
+      매 k 마다 메모리에서 다시 읽음
+    - 칸마다 NO_EDGE 검사 분기가 있어 벡터화도 안 됨
+
+    [타일 분할]
+    - 행렬을 FW_BLOCK x FW_BLOCK 타일로 나누고, k 도 FW_BLOCK 개씩 묶어 처리
+      (int 64 x 64 타일 = 16KB, 타일 3개가 L2 캐시에 들어감)
+    - k 묶음 kb 마다 세 단계
+        1) 대각 타일 (kb, kb)        : 타일 안에서 기본형 Floyd-Warshall
+        2) kb 행/열 타일 (kb, j), (i, kb) : 1)의 대각 타일만 사용 → 서로 독립
+        3) 나머지 타일 (i, j)        : 2)의 (i, kb), (kb, j) 만 사용 → 서로 독립
+    - 2), 3) 단계의 타일들을 스레드들이 나눠 처리
+
+    [분기 없는 최솟값]
+    - 도달 불가를 NO_EDGE 대신 FW_UNREACHABLE (int 최댓값의 절반 정도)로 표현
+      → 두 값을 더해도 int 가 넘치지 않으므로 검사 없이
+        c[i][j] = min(c[i][j], a[i][k] + b[k][j]) 를 그대로 계산
+    - AVX-512 / AVX2 로 컴파일하면 min_epi32 로 16 / 8 칸씩 처리
+    - 도달 불가 칸은 음수 간선을 거치며 조금 줄어들 수 있으므로
+      FW_REACH_LIMIT 이상이면 도달 불가로 본다.
+      (정점 수 x 최대 |가중치| 가 FW_REACH_LIMIT 보다 작을 때만 정확하므로
+       그보다 크면 all_costs_reference 를 사용)
+*/
+#define FW_BLOCK 64
+#define FW_UNREACHABLE 0x3FFFFFFF
+#define FW_REACH_LIMIT 0x20000000
+
+/* c[j] = min(c[j], a + b[j]), j = 0 ~ FW_BLOCK - 1 (c 와 b 가 같은 행이어도 됨) */
+void min_plus_row(int* c, const int* b, int a)
+{
+#if defined(__AVX512F__)
+    __m512i va = _mm512_set1_epi32(a);
+    for (int j = 0; j < FW_BLOCK; j += 16) {
+        __m512i sum = _mm512_add_epi32(va, _mm512_loadu_si512((const void*)(b + j)));
+        __m512i cur = _mm512_loadu_si512((const void*)(c + j));
+        _mm512_storeu_si512((void*)(c + j), _mm512_min_epi32(cur, sum));
+    }
+#elif defined(__AVX2__)
+    __m256i va = _mm256_set1_epi32(a);
+    for (int j = 0; j < FW_BLOCK; j += 8) {
+        __m256i sum = _mm256_add_epi32(va, _mm256_loadu_si256((const __m256i*)(b + j)));
+        __m256i cur = _mm256_loadu_si256((const __m256i*)(c + j));
+        _mm256_storeu_si256((__m256i*)(c + j), _mm256_min_epi32(cur, sum));
+    }
+#else
+    int sum[FW_BLOCK];      // c 와 b 가 겹쳐도 컴파일러가 벡터화할 수 있도록 나눠 계산
+    for (int j = 0; j < FW_BLOCK; j++)
+        sum[j] = a + b[j];
+    for (int j = 0; j < FW_BLOCK; j++)
+        c[j] = sum[j] < c[j] ? sum[j] : c[j];
+#endif
+}
+
+/*
+    타일 하나 갱신 : c[i][j] = min(c[i][j], a[i][k] + b[k][j])
+    - a, b, c 는 타일의 왼쪽 위 칸, stride 는 행 간격
+    - 1), 2) 단계처럼 c 가 a 또는 b 와 같은 타일이어도
+      음수 사이클이 없으면 (대각 0 이상) 기본형과 같은 결과
+*/
+void fw_tile(int* c, const int* a, const int* b, int stride)
+{
+    for (int k = 0; k < FW_BLOCK; k++)
+        for (int i = 0; i < FW_BLOCK; i++)
+            min_plus_row(c + (size_t)i * stride, b + (size_t)k * stride, a[(size_t)i * stride + k]);
+}
+
+/*
+    ===== 다음 정점도 함께 갱신하는 타일 연산 =====
+    - 거리가 줄어든 칸에만 next[j] = hop (hop = i 에서 k 로 갈 때의 다음 정점)
+    - 비교 결과를 마스크로 써서 분기 없이 섞음 (blend)
+      16비트 다음 정점은 32비트 비교 마스크를 절반 폭으로 줄여(packs) 사용
+    - AVX-512 로 컴파일해도 이 경로는 AVX2 명령을 사용
+*/
+template <typename Hop>
+void min_plus_row_hop_scalar(int* c, const int* b, int a, Hop* next, Hop hop)
+{
+    int sum[FW_BLOCK];
+    for (int j = 0; j < FW_BLOCK; j++)
+        sum[j] = a + b[j];
+    for (int j = 0; j < FW_BLOCK; j++) {
+        int better = sum[j] < c[j];
+        c[j] = better ? sum[j] : c[j];
+        next[j] = better ? hop : next[j];
+    }
+}
+
+void min_plus_row_hop(int* c, const int* b, int a, unsigned short* next, unsigned short hop)
+{
+#if defined(__AVX2__)
+    __m256i va = _mm256_set1_epi32(a);
+    __m128i vh = _mm_set1_epi16((short)hop);
+    for (int j = 0; j < FW_BLOCK; j += 8) {
+        __m256i sum = _mm256_add_epi32(va, _mm256_loadu_si256((const __m256i*)(b + j)));
+        __m256i cur = _mm256_loadu_si256((const __m256i*)(c + j));
+        __m256i better = _mm256_cmpgt_epi32(cur, sum);
+        __m128i better16 = _mm_packs_epi32(_mm256_castsi256_si128(better),
+                                           _mm256_extracti128_si256(better, 1));
+        __m128i nh = _mm_loadu_si128((const __m128i*)(next + j));
+        _mm256_storeu_si256((__m256i*)(c + j), _mm256_min_epi32(cur, sum));
+        _mm_storeu_si128((__m128i*)(next + j), _mm_blendv_epi8(nh, vh, better16));
+    }
+#else
+    min_plus_row_hop_scalar(c, b, a, next, hop);
+#endif
+}
+
+void min_plus_row_hop(int* c, const int* b, int a, unsigned int* next, unsigned int hop)
+{
+#if defined(__AVX2__)
+    __m256i va = _mm256_set1_epi32(a);
+    __m256i vh = _mm256_set1_epi32((int)hop);
+    for (int j = 0; j < FW_BLOCK; j += 8) {
+        __m256i sum = _mm256_add_epi32(va, _mm256_loadu_si256((const __m256i*)(b + j)));
+        __m256i cur = _mm256_loadu_si256((const __m256i*)(c + j));
+        __m256i better = _mm256_cmpgt_epi32(cur, sum);
+        __m256i nh = _mm256_loadu_si256((const __m256i*)(next + j));
+        _mm256_storeu_si256((__m256i*)(c + j), _mm256_min_epi32(cur, sum));
+        _mm256_storeu_si256((__m256i*)(next + j), _mm256_blendv_epi8(nh, vh, better));
+    }
+#else
+    min_plus_row_hop_scalar(c, b, a, next, hop);
+#endif
+}
+
+/*
+    타일 하나 갱신 + 다음 정점 (nc : c 타일의 다음 정점, na : a 타일의 다음 정점)
+    - c 가 a 와 같은 타일이어도 hop(i, k) 는 k 단계에서 바뀌지 않으므로 미리 읽어도 됨
+*/
+template <typename Hop>
+void fw_tile_hop(int* c, const int* a, const int* b, Hop* nc, const Hop* na, int stride)
+{
+    for (int k = 0; k < FW_BLOCK; k++)
+        for (int i = 0; i < FW_BLOCK; i++) {
+            size_t row = (size_t)i * stride;
+            min_plus_row_hop(c + row, b + (size_t)k * stride, a[row + k], nc + row, na[row + k]);
+        }
+}
+
+/*
+    ===== parallel_for =====
+    - [0, count) 를 threads 개의 연속 조각으로 나눠 fn(begin, end) 호출
+    - 일이 하나뿐이면 현재 스레드에서 바로 실행
+*/
+template <typename F>
+void parallel_for(int threads, int count, F fn)
+{
+    if (threads <= 1 || count <= 1) {
+        fn(0, count);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    int chunk = (count + threads - 1) / threads;
+    for (int begin = 0; begin < count; begin += chunk)
+        pool.emplace_back(fn, begin, begin + chunk < count ? begin + chunk : count);
+    for (auto& th : pool) th.join();
+}
+
+/*
+    ===== blocked_floyd =====
+    - d : stride x stride 작업 행렬 (stride = blocks * FW_BLOCK)
+    - h : 같은 모양의 다음 정점 행렬, NULL 이면 거리만 계산
+*/
+template <typename Hop>
+void blocked_floyd(int* d, Hop* h, int stride, int blocks, int threads)
+{
+    // 타일 (r, c) 의 왼쪽 위 칸 위치
+    auto at = [&](int r, int c) { return ((size_t)r * stride + c) * FW_BLOCK; };
+    auto tile = [&](size_t c, size_t a, size_t b) {
+        if (h) fw_tile_hop(d + c, d + a, d + b, h + c, h + a, stride);
+        else fw_tile(d + c, d + a, d + b, stride);
+    };
+
+    for (int kb = 0; kb < blocks; kb++) {
+        size_t diag = at(kb, kb);
+
+        // 1) 대각 타일
+        tile(diag, diag, diag);
+
+        // 2) kb 행의 타일 (0 ~ blocks - 1) 과 kb 열의 타일 (blocks ~ 2 * blocks - 1)
+        parallel_for(threads, 2 * blocks, [&](int b, int e) {
+            for (int t = b; t < e; t++) {
+                int x = t % blocks;
+                if (x == kb) continue;
+                if (t < blocks) tile(at(kb, x), diag, at(kb, x));
+                else tile(at(x, kb), at(x, kb), diag);
+            }
+        });
+
+        // 3) 나머지 타일
+        parallel_for(threads, blocks * blocks, [&](int b, int e) {
+            for (int t = b; t < e; t++) {
+                int r = t / blocks, c = t % blocks;
+                if (r == kb || c == kb) continue;
+                tile(at(r, c), at(r, kb), at(kb, c));
+            }
+        });
+    }
+}
+
+/*
+    다음 정점을 Hop 폭의 작업 행렬에서 계산한 뒤 n x n 으로 옮겨 담음
+    (늘어난 칸과 경로 없음은 Hop 의 최댓값)
+*/
+template <typename Hop>
+void blocked_floyd_with_hops(int* d, int** cost, int n, int stride, int blocks, int threads,
+                             Hop* out)
+{
+    const Hop none = (Hop)~(Hop)0;
+    Hop* h = (Hop*)malloc(sizeof(Hop) * ((size_t)stride * stride + 1));
+    if (!h) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (int i = 0; i < stride; i++)
+        for (int j = 0; j < stride; j++)
+            h[(size_t)i * stride + j] =
+                i < n && j < n && (i == j || cost[i][j] != NO_EDGE) ? (Hop)j : none;
+
+    blocked_floyd(d, h, stride, blocks, threads);
+
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            out[(size_t)i * n + j] = d[(size_t)i * stride + j] >= FW_REACH_LIMIT ? none
+                                     : h[(size_t)i * stride + j];
+    free(h);
+}
+
+/*
+    ===== allCosts =====
+    - n 을 FW_BLOCK 배수로 올린 작업 행렬에 복사해 타일 분할 Floyd-Warshall 수행
+      (늘어난 칸은 다른 정점과 연결되지 않은 정점)
+    - threads : 2), 3) 단계에 쓸 스레드 수
+    - next    : NULL 이 아니면 경로 복원용 다음 정점 행렬도 계산 (init_next_hop 으로 준비)
+*/
+void allCosts(int** cost, int** distance, int n, int threads, NextHop* next)
+{
+    long long bound = 0;
+    int i, j;
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            if (cost[i][j] != NO_EDGE) {
+                long long w = cost[i][j] < 0 ? -(long long)cost[i][j] : cost[i][j];
+                if (w > bound) bound = w;
+            }
+    if (bound * n >= FW_REACH_LIMIT) {
+        all_costs_reference(cost, distance, n, next);
+        return;
+    }
+
+    int blocks = (n + FW_BLOCK - 1) / FW_BLOCK;
+    int stride = blocks * FW_BLOCK;
+    int* d = (int*)malloc(sizeof(int) * ((size_t)stride * stride + 1));
+    if (!d) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+
+    for (i = 0; i < stride; i++)
+        for (j = 0; j < stride; j++) {
+            int w = i < n && j < n ? cost[i][j] : (i == j ? 0 : NO_EDGE);
+            d[(size_t)i * stride + j] = w == NO_EDGE ? FW_UNREACHABLE : w;
+        }
+
+    if (!next) blocked_floyd<unsigned short>(d, NULL, stride, blocks, threads);
+    else if (next->wide) blocked_floyd_with_hops(d, cost, n, stride, blocks, threads, next->hop32);
+    else blocked_floyd_with_hops(d, cost, n, stride, blocks, threads, next->hop16);
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++) {
+            int v = d[(size_t)i * stride + j];
+            distance[i][j] = v >= FW_REACH_LIMIT ? NO_EDGE : v;
+        }
+    free(d);
+}
+
+/*
+    ===== check_routes (경로 복원 검증) =====
+    - 모든 (i, j) 에 대해 route 로 복원한 경로가 실제 간선으로 이어지고
+      간선 가중치 합이 distance[i][j] 와 같은지 확인
+    - i == j 는 빈 경로이므로 제외 (자기 루프 가중치가 distance 에 남을 수 있음)
+    - 반환값 : 잘못된 칸 수
+*/
+int check_routes(int** cost, int** distance, const NextHop* next, int n)
+{
+    int* path = (int*)malloc(sizeof(int) * (n + 1));
+    int errors = 0;
+
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+            if (i == j) continue;
+            int count = route(next, i, j, path);
+            if (count == 0) {
+                errors += distance[i][j] != NO_EDGE;
+                continue;
+            }
+            long long sum = 0;
+            int ok = path[0] == i && path[count - 1] == j && count <= n;
+            for (int k = 0; ok && k + 1 < count; k++) {
+                ok = cost[path[k]][path[k + 1]] != NO_EDGE;
+                sum += cost[path[k]][path[k + 1]];
+            }
+            if (!ok || sum != distance[i][j]) errors++;
+        }
+
+    free(path);
+    return errors;
+}
+
+/* ===== 경로 출력 : from -> ... -> to ===== */
+void print_route(const int* path, int count)
+{
+    for (int k = 0; k < count; k++)
+        printf(k ? " -> %d" : "%d", path[k]);
 }
 
 /*
@@ -170,10 +779,8 @@ void allCosts(int cost[][MAX_VERTICES],
     - 실제로는 n 값만 증가 (인접 행렬은 이미 초기화됨)
 */
 void insert_vertex(GraphType* g, int v) {
-    if (((g->n) + 1) > MAX_VERTICES) {
-        fprintf(stderr, "overflow");
-        return;
-    }
+    (void)v;            // 정점 번호는 항상 g->n (순서대로 추가)
+    grow(g, g->n + 1);  // 행렬이 꽉 찼으면 확장
     g->n++;
 }
 
@@ -186,18 +793,112 @@ void insert_vertex(GraphType* g, int v) {
        adj_mat[to][from] = w 도 추가해야 함
 */
 void insert_edge(GraphType* g, int from, int to, int w) {
-    if (from >= g->n || to >= g->n) {
+    if (from < 0 || to < 0 || from >= g->n || to >= g->n) {
         fprintf(stderr, "vertex key error");
         return;
     }
     g->adj_mat[from][to] = w;
 }
 
+/*
+    ===== 동적 갱신 : 간선 삽입 / 가중치 감소 =====
+    - 간선 비용이 자주 바뀔 때마다 shortestPath / allCosts 를 처음부터 다시 돌리는 대신
+      이미 구한 결과에서 "더 짧아지는 부분" 만 고침
+    - 가중치가 줄거나 새 간선이 생기면 거리는 줄어들기만 하므로 가능
+      (가중치 증가 / 음수 가중치는 다른 경로가 최단이 될 수 있어 전체 재계산 필요)
+*/
+
+/*
+    ===== update_sssp =====
+    - cost[from][to] 가 이미 w 로 줄어든 상태에서 distance / pred 를 고침
+    - to 의 거리가 줄면 to 에서 시작해 거리가 줄어드는 정점만 힙으로 다시 완화
+      (줄어든 정점마다 한 번씩 행을 훑음, 나머지 정점은 건드리지 않음)
+    - 반환값 : 거리가 바뀐 정점 수, 음수 가중치면 -1 (전체 재계산 필요)
+*/
+int update_sssp(int** cost, long long distance[], int pred[], int n, int from, int to, int w)
+{
+    typedef std::pair<long long, int> Item;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item> > heap;
+    int changed = 0;
+
+    if (w < 0) return -1;
+    if (distance[from] == UNREACHABLE || distance[from] + w >= distance[to]) return 0;
+
+    distance[to] = distance[from] + w;
+    if (pred) pred[to] = from;
+    heap.push(Item(distance[to], to));
+
+    while (!heap.empty()) {
+        Item top = heap.top();
+        heap.pop();
+        int u = top.second;
+        if (top.first != distance[u]) continue;     // 낡은 항목
+        changed++;
+        for (int x = 0; x < n; x++) {
+            if (cost[u][x] == NO_EDGE || distance[u] + cost[u][x] >= distance[x]) continue;
+            distance[x] = distance[u] + cost[u][x];
+            if (pred) pred[x] = u;
+            heap.push(Item(distance[x], x));
+        }
+    }
+    return changed;
+}
+
+/*
+    ===== update_all_costs =====
+    - from → to 간선이 w 로 줄었을 때 모든 쌍 거리 / 다음 정점 행렬을 고침
+    - 새 최단 경로는 i → ... → from → to → ... → j 모양뿐
+        distance[i][j] = min(distance[i][j], d(i, from) + w + d(to, j))
+    - 가중치가 0 이상이면 from 으로 가는 거리와 to 에서 나가는 거리는 이 간선으로 줄지 않음
+      → 그 열/행을 먼저 복사해 두고 제자리에서 갱신
+    - i → to 가 줄지 않는 행 i 와 from → j 가 줄지 않는 열 j 는 나머지 칸도 줄지 않으므로
+      "줄어드는 행 x 줄어드는 열" 만 훑음 (최악 O(V^2), 보통 훨씬 적음)
+    - 반환값 : 바뀐 칸 수, 음수 가중치면 -1 (전체 재계산 필요)
+*/
+int update_all_costs(int** distance, NextHop* next, int n, int from, int to, int w)
+{
+    std::vector<long long> into(n), out(n);     // d(i, from), d(to, j) (도달 불가는 -1)
+    std::vector<int> rows, cols;
+    int changed = 0;
+
+    if (w < 0) return -1;
+    for (int i = 0; i < n; i++) {
+        into[i] = i == from ? 0 : distance[i][from] == NO_EDGE ? -1 : distance[i][from];
+        out[i] = i == to ? 0 : distance[to][i] == NO_EDGE ? -1 : distance[to][i];
+    }
+    for (int i = 0; i < n; i++)
+        if (into[i] >= 0 && (distance[i][to] == NO_EDGE || into[i] + w < distance[i][to]))
+            rows.push_back(i);
+    for (int j = 0; j < n; j++)
+        if (out[j] >= 0 && (distance[from][j] == NO_EDGE || w + out[j] < distance[from][j]))
+            cols.push_back(j);
+
+    for (size_t r = 0; r < rows.size(); r++) {
+        int i = rows[r];
+        int hop = i == from ? to : next ? next_hop(next, i, from) : -1;
+        for (size_t c = 0; c < cols.size(); c++) {
+            int j = cols[c];
+            long long sum = into[i] + w + out[j];
+            if (sum >= NO_EDGE) sum = NO_EDGE - 1;    // all_costs_reference 와 같은 포화
+            if (sum >= distance[i][j]) continue;
+            distance[i][j] = (int)sum;
+            if (next) set_next_hop(next, i, j, hop);
+            changed++;
+        }
+    }
+    return changed;
+}
+
 /*
     ===== main =====
+    - 실행 인자 check : 최단 경로마다 기준 구현(Bellman-Ford)과 교차 검증,
+                        모든 쌍 최단 경로는 기본형 Floyd-Warshall 과 비교
+                        (11.5 동적 갱신도 갱신마다 둘 다와 비교)
 */
-int main() {
+int main(int argc, char** argv) {
     int n, from, to, w, start;
+    int check = argc >= 2 && strcmp(argv[1], "check") == 0;
+    int threads = (int)std::thread::hardware_concurrency();
     GraphType* g;
 
     g = (GraphType*)malloc(sizeof(GraphType));
@@ -227,8 +928,9 @@ int main() {
     */
     printf("\n11.2. 최단 경로 (단일 출발점)\n");
 
-    int distance[MAX_VERTICES];
-    short int found[MAX_VERTICES];
+    long long* distance = (long long*)malloc(sizeof(long long) * (g->n + 1));
+    short int* found = (short int*)malloc(sizeof(short int) * (g->n + 1));
+    int* pred = (int*)malloc(sizeof(int) * (g->n + 1));
 
     while (1) {
         printf("\n시작 노드 (v) : ");
@@ -237,13 +939,14 @@ int main() {
         if (start == -1)
             break;
 
-        shortestPath(start, g->adj_mat, distance, g->n, found);
+        if (shortestPath(start, g->adj_mat, distance, g->n, found, pred) != 0)
+            continue;
+        print_distance(distance, g->n);
 
-        printf("Distance : ");
-        for (int i = 0; i < g->n; i++) {
-            printf("%3d ", distance[i]);
+        if (check) {
+            int errors = check_sssp(start, g->adj_mat, distance, pred, g->n);
+            printf(errors ? "  검증 : 오류 %d개\n" : "  검증 : 통과\n", errors);
         }
-        printf("\n");
     }
 
     /*
@@ -251,8 +954,11 @@ int main() {
     */
     printf("\n11.3. 최단 경로 (모든 경로)\nAll Path Distance :\n");
 
-    int allDist[MAX_VERTICES][MAX_VERTICES];
-    allCosts(g->adj_mat, allDist, g->n);
+    int** allDist = alloc_matrix(g->n);
+    NextHop next;
+    if (threads < 1) threads = 1;
+    init_next_hop(&next, g->n);
+    allCosts(g->adj_mat, allDist, g->n, threads, &next);
 
     printf("\t");
     for (int i = 0; i < g->n; i++) {
@@ -263,10 +969,105 @@ int main() {
     for (int i = 0; i < g->n; i++) {
         printf("[%2d]\t", i);
         for (int j = 0; j < g->n; j++) {
-            printf("%d\t", allDist[i][j]);
+            if (allDist[i][j] == NO_EDGE) printf("INF\t");
+            else printf("%d\t", allDist[i][j]);
         }
         printf("\n");
     }
 
+    if (check) {
+        int** ref = alloc_matrix(g->n);
+        int errors = 0;
+        all_costs_reference(g->adj_mat, ref, g->n, NULL);
+        for (int i = 0; i < g->n; i++)
+            for (int j = 0; j < g->n; j++)
+                if (allDist[i][j] != ref[i][j]) errors++;
+        printf(errors ? "  검증 : %d칸이 기본형과 다름\n" : "  검증 : 통과\n", errors);
+        errors = check_routes(g->adj_mat, allDist, &next, g->n);
+        printf(errors ? "  경로 검증 : %d칸 오류\n" : "  경로 검증 : 통과\n", errors);
+        free_matrix(ref);
+    }
+
+    /*
+        11.4 경로 복원 (Floyd-Warshall 다음 정점 행렬, check 면 Dijkstra pred 와 비교)
+    */
+    printf("\n11.4. 최단 경로 복원\n");
+    int* path = (int*)malloc(sizeof(int) * (g->n + 1));
+    while (1) {
+        printf("경로 (from to) : ");
+        if (scanf("%d %d", &from, &to) != 2 || from == -1)
+            break;
+        if (from < 0 || to < 0 || from >= g->n || to >= g->n) {
+            fprintf(stderr, "정점 번호 오류\n");
+            continue;
+        }
+
+        int count = route(&next, from, to, path);
+        if (count == 0) printf("경로 없음\n");
+        else {
+            print_route(path, count);
+            printf(" (비용 %d)\n", allDist[from][to]);
+        }
+
+        if (check && shortestPath(from, g->adj_mat, distance, g->n, found, pred) == 0) {
+            int sssp_count = sssp_route(pred, from, to, path);
+            int same = sssp_count == 0 ? count == 0
+                       : count != 0 && distance[to] == allDist[from][to];
+            printf(same ? "  검증 : Dijkstra 경로와 비용 일치\n"
+                        : "  검증 : Dijkstra 경로와 비용이 다름\n");
+        }
+    }
+
+    /*
+        11.5 동적 갱신 (기준 노드의 거리와 모든 쌍 행렬을 간선 갱신마다 바로 고침)
+    */
+    printf("\n11.5. 동적 갱신 (간선 삽입 / 가중치 감소)\n기준 노드 (v) : ");
+    if (scanf("%d", &start) == 1 && start >= 0 && start < g->n &&
+        shortestPath(start, g->adj_mat, distance, g->n, found, pred) == 0) {
+        while (1) {
+            printf("에지 갱신 (from to weight) : ");
+            if (scanf("%d %d %d", &from, &to, &w) != 3 || (from == -1 && to == -1 && w == -1))
+                break;
+            if (from < 0 || to < 0 || from >= g->n || to >= g->n || w < 0) {
+                fprintf(stderr, "정점 번호 또는 가중치 오류\n");
+                continue;
+            }
+
+            int old = g->adj_mat[from][to];
+            insert_edge(g, from, to, w);
+            if (old != NO_EDGE && w > old) {    // 가중치 증가 : 기존 결과를 고칠 수 없음
+                shortestPath(start, g->adj_mat, distance, g->n, found, pred);
+                allCosts(g->adj_mat, allDist, g->n, threads, &next);
+                printf("  가중치 증가 : 전체 재계산\n");
+            }
+            else {
+                int vertices = update_sssp(g->adj_mat, distance, pred, g->n, from, to, w);
+                int cells = update_all_costs(allDist, &next, g->n, from, to, w);
+                printf("  거리가 바뀐 정점 %d개, 모든 쌍 행렬에서 바뀐 칸 %d개\n", vertices, cells);
+            }
+            print_distance(distance, g->n);
+
+            if (check) {
+                int** ref = alloc_matrix(g->n);
+                int errors = check_sssp(start, g->adj_mat, distance, pred, g->n);
+                all_costs_reference(g->adj_mat, ref, g->n, NULL);
+                for (int i = 0; i < g->n; i++)
+                    for (int j = 0; j < g->n; j++)
+                        if (allDist[i][j] != ref[i][j]) errors++;
+                errors += check_routes(g->adj_mat, allDist, &next, g->n);
+                printf(errors ? "  검증 : 오류 %d개\n" : "  검증 : 통과\n", errors);
+                free_matrix(ref);
+            }
+        }
+    }
+
+    free(path);
+    free_next_hop(&next);
+    free_matrix(allDist);
+    free(distance);
+    free(found);
+    free(pred);
+    free_graph(g);
+    free(g);
     return 0;
 }
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <math.h>
+#include <string.h>
 
 /*
     ===== 이진 탐색 트리(BST) 실습 코드 =====
@@ -12,6 +13,7 @@
     9.2) 사용자로부터 key를 입력받아 BST에서 검색(재귀) + 비교 횟수(search_count) 출력
     9.3) 임의의 key로 n개 노드를 삽입하여 BST 생성 시간을 측정하고,
          생성된 트리의 (노드 수 / 높이 / 단말 노드 수) 관찰
+         + 깊이 분포, 경로 길이, 균형 인수 분포, 연산별 방문 횟수를 JSON으로 출력
 
     [BST 성질]
     - 어떤 노드의 key 기준:
@@ -42,10 +44,39 @@ typedef struct node {
 } node;
 
 /*
-    search() 수행 중 "몇 개의 노드를 방문했는지" 세기 위한 전역 변수
-    - 검색 과정에서 재귀 호출될 때마다 1씩 증가
+    연산별 노드 방문(probe) 카운터
+    - search / insert 가 노드를 하나 방문할 때마다 해당 probe 값 증가
+    - thread_local 이라서 여러 스레드가 동시에 검색해도 서로 덮어쓰지 않음
+      (예전 전역 search_count 는 스레드 간 경쟁 상태가 있었음)
 */
-int search_count;
+typedef struct {
+    long long search_calls;     // search 호출 횟수 (재귀 제외, 최상위 호출 기준)
+    long long search_probes;    // search 가 방문한 노드 수 누적
+    long long insert_calls;
+    long long insert_probes;    // modified_search 가 방문한 노드 수 누적
+} OpCounters;
+
+thread_local OpCounters op_counters;
+
+/*
+    한 번의 순회로 모으는 트리 통계
+    - depth_hist[d] : 깊이가 d인 노드 수 (root 깊이 0)
+    - internal_path : 모든 노드 깊이의 합
+    - external_path : 모든 NULL 링크(외부 노드) 깊이의 합 = internal_path + 2 * node_count
+    - bf_hist[BF_RANGE + b] : 균형 인수(왼쪽 높이 - 오른쪽 높이)가 b인 노드 수
+      (|b| > BF_RANGE 는 양 끝 칸에 모음)
+*/
+#define BF_RANGE 8
+
+typedef struct {
+    int node_count;
+    int height;                 // 빈 트리 -1, 노드 1개 0
+    int leaf_count;
+    long long internal_path;
+    long long external_path;
+    int* depth_hist;            // 길이 height + 1
+    int bf_hist[2 * BF_RANGE + 1];
+} TreeStats;
 
 /*
     ===== BST 검색(재귀) =====
@@ -59,27 +90,33 @@ int search_count;
     특징:
     - BST 성질을 이용하여 left 또는 right로만 내려감
     - 시간복잡도: 평균 O(log n), 최악(편향 트리) O(n)
+    - 호출 횟수는 search 가, 방문 노드 수는 재귀하는 search_walk 가 셈
 */
-element* search(treePointer tree, int k) {
+element* search_walk(treePointer tree, int k) {
     // 현재 노드가 NULL이면 더 내려갈 곳이 없으므로 실패
     if (!tree) return NULL;
 
-    // 노드 하나를 방문했으므로 count 증가
-    search_count++;
+    // 노드 하나를 방문했으므로 probe 증가
+    op_counters.search_probes++;
 
     // 현재 노드의 key가 찾는 key와 같으면 성공 -> data 주소 반환
     if (k == tree->data.key) return &(tree->data);
 
     // 찾는 key가 더 작으면 왼쪽 서브트리로 재귀 검색
     if (k < tree->data.key) {
-        return search(tree->leftChild, k);
+        return search_walk(tree->leftChild, k);
     }
     // 찾는 key가 더 크면 오른쪽 서브트리로 재귀 검색
     else {
-        return search(tree->rightChild, k);
+        return search_walk(tree->rightChild, k);
     }
 }
 
+element* search(treePointer tree, int k) {
+    op_counters.search_calls++;     // 최상위 호출만 셈 (재귀는 search_walk)
+    return search_walk(tree, k);
+}
+
 /*
     ===== modified_search (삽입을 위한 탐색) =====
     tree: BST 루트
@@ -96,8 +133,11 @@ element* search(treePointer tree, int k) {
 treePointer modified_search(treePointer tree, int key) {
     treePointer temp = NULL;  // 마지막으로 방문한 노드(부모 후보)
 
+    op_counters.insert_calls++;
+
     // tree가 NULL이 될 때까지 내려감
     while (tree) {
+        op_counters.insert_probes++;
         temp = tree; // 현재 노드를 기억(부모 후보)
         if (key == tree->data.key) return tree; // 이미 존재하면 바로 반환
 
@@ -167,59 +207,131 @@ void insert(treePointer* node, int k, double theItem) {
 }
 
 /*
-    ===== 노드 개수 세기(재귀) =====
-    ptr이 NULL이면 0
-    아니면 1(현재노드) + 왼쪽 노드 수 + 오른쪽 노드 수
+    ===== collect_stats : 한 번의 후위 순회로 모든 통계 계산 =====
+    - 예전에는 count_node / count_depth / count_leaf 가 각각 트리 전체를
+      재귀로 한 번씩 돌았음 (3회 순회 + 편향 트리에서 재귀 깊이 n)
+    - 명시적 스택으로 후위 순회하며
+      내려갈 때 깊이, 올라올 때 서브트리 높이를 계산
+
+    스택 프레임:
+    - ptr   : 현재 노드
+    - depth : 현재 노드 깊이
+    - left_h: 왼쪽 서브트리 높이 (왼쪽 처리가 끝난 뒤 채워짐)
+    - state : 0 = 왼쪽으로 내려갈 차례, 1 = 오른쪽, 2 = 자신 처리
 */
-int count_node(treePointer ptr) {
-    if (ptr) {
-        return 1 + count_node(ptr->leftChild) + count_node(ptr->rightChild);
+typedef struct {
+    treePointer ptr;
+    int depth;
+    int left_h;
+    int state;
+} StatsFrame;
+
+void collect_stats(treePointer root, TreeStats* st) {
+    int capacity = 64, top = 0, hist_size = 0;
+    int child_h = -1;   // 방금 끝난 서브트리의 높이
+    StatsFrame* stack = (StatsFrame*)malloc(sizeof(StatsFrame) * capacity);
+
+    memset(st, 0, sizeof(*st));
+    st->height = -1;
+    if (!root) {
+        st->external_path = 0;  // 빈 트리: 외부 노드 1개, 깊이 0
+        free(stack);
+        return;
     }
-    return 0;
-}
 
-/*
-    ===== 트리 높이(깊이) 계산(재귀) =====
-    여기서 "높이(깊이)" 정의:
-    - NULL의 깊이를 -1로 둠
-    - 리프 노드의 깊이는 0
-    - 높이 = max(left_height, right_height) + 1
-
-    예)
-    - 노드가 1개(root만): left/right는 NULL -> -1
-      max(-1,-1)+1 = 0  => 높이 0
-*/
-int count_depth(treePointer ptr) {
-    // 빈 트리(NULL)의 높이를 -1로 정의
-    if (!ptr) {
-        return -1;
-    }
+    stack[top++] = { root, 0, -1, 0 };
+    while (top) {
+        StatsFrame* f = &stack[top - 1];
+        treePointer next = NULL;
+
+        if (f->state == 0) {
+            // 처음 방문: 깊이 관련 통계 기록
+            if (f->depth >= hist_size) {
+                int new_size = hist_size ? hist_size * 2 : 64;
+                while (new_size <= f->depth) new_size *= 2;
+                st->depth_hist = (int*)realloc(st->depth_hist, sizeof(int) * new_size);
+                memset(st->depth_hist + hist_size, 0, sizeof(int) * (new_size - hist_size));
+                hist_size = new_size;
+            }
+            st->depth_hist[f->depth]++;
+            st->node_count++;
+            st->internal_path += f->depth;
+            if (!f->ptr->leftChild) st->external_path += f->depth + 1;
+            if (!f->ptr->rightChild) st->external_path += f->depth + 1;
+            if (!f->ptr->leftChild && !f->ptr->rightChild) st->leaf_count++;
+
+            f->state = 1;
+            next = f->ptr->leftChild;
+            child_h = -1;
+        }
+        else if (f->state == 1) {
+            f->left_h = child_h;
+            f->state = 2;
+            next = f->ptr->rightChild;
+            child_h = -1;
+        }
+        else {
+            // 왼쪽/오른쪽 높이가 모두 정해짐
+            int right_h = child_h;
+            int bf = f->left_h - right_h;
+            if (bf < -BF_RANGE) bf = -BF_RANGE;
+            if (bf > BF_RANGE) bf = BF_RANGE;
+            st->bf_hist[bf + BF_RANGE]++;
+
+            child_h = (f->left_h > right_h ? f->left_h : right_h) + 1;
+            top--;
+            continue;
+        }
 
-    // 왼쪽/오른쪽 서브트리 높이 계산
-    int left_depth = count_depth(ptr->leftChild);
-    int right_depth = count_depth(ptr->rightChild);
+        if (next) {
+            int depth = f->depth + 1;
+            if (top == capacity) {
+                capacity *= 2;
+                stack = (StatsFrame*)realloc(stack, sizeof(StatsFrame) * capacity);
+            }
+            stack[top++] = { next, depth, -1, 0 };
+        }
+    }
+    st->height = child_h;
+    free(stack);
+}
 
-    // 더 큰 쪽 + 1
-    return (left_depth > right_depth ? left_depth : right_depth) + 1;
+void free_stats(TreeStats* st) {
+    free(st->depth_hist);
+    st->depth_hist = NULL;
 }
 
 /*
-    ===== 단말(리프) 노드 수 세기(재귀) =====
-    - 리프: leftChild도 NULL, rightChild도 NULL인 노드
+    ===== print_stats_json =====
+    트리 통계 + 현재 스레드의 연산 카운터를 JSON 한 덩어리로 출력
+    - 외부 도구(로그 수집 등)에서 그대로 파싱할 수 있도록 키 이름 고정
 */
-int count_leaf(treePointer ptr) {
-    // 빈 트리는 리프 0개
-    if (!ptr) {
-        return 0;
-    }
-
-    // 자식이 둘 다 없으면 리프 1개
-    if (!ptr->leftChild && !ptr->rightChild) {
-        return 1;
+void print_stats_json(FILE* fp, const TreeStats* st, const OpCounters* ops) {
+    int i;
+
+    fprintf(fp, "{\n  \"node_count\": %d,\n  \"height\": %d,\n  \"leaf_count\": %d,\n",
+            st->node_count, st->height, st->leaf_count);
+    fprintf(fp, "  \"internal_path_length\": %lld,\n  \"external_path_length\": %lld,\n",
+            st->internal_path, st->external_path);
+    fprintf(fp, "  \"avg_depth\": %.3f,\n",
+            st->node_count ? (double)st->internal_path / st->node_count : 0.0);
+
+    fprintf(fp, "  \"depth_histogram\": [");
+    for (i = 0; i <= st->height; i++)
+        fprintf(fp, "%s%d", i ? ", " : "", st->depth_hist[i]);
+    fprintf(fp, "],\n");
+
+    fprintf(fp, "  \"balance_factor_histogram\": {");
+    for (i = 0; i < 2 * BF_RANGE + 1; i++) {
+        int bf = i - BF_RANGE;
+        const char* prefix = (bf == -BF_RANGE) ? "<=" : (bf == BF_RANGE) ? ">=" : "";
+        fprintf(fp, "%s\"%s%d\": %d", i ? ", " : "", prefix, bf, st->bf_hist[i]);
     }
+    fprintf(fp, "},\n");
 
-    // 아니면 왼쪽 리프 수 + 오른쪽 리프 수
-    return count_leaf(ptr->leftChild) + count_leaf(ptr->rightChild);
+    fprintf(fp, "  \"ops\": {\"search_calls\": %lld, \"search_probes\": %lld, "
+                "\"insert_calls\": %lld, \"insert_probes\": %lld}\n}\n",
+            ops->search_calls, ops->search_probes, ops->insert_calls, ops->insert_probes);
 }
 
 /*
@@ -307,7 +419,7 @@ int main() {
         9.2) key 검색 + 방문 횟수 출력
         =========================
         - 사용자가 key를 입력하면 search()로 찾음
-        - search_count는 노드 방문 횟수(비교 횟수 느낌)로 사용
+        - op_counters.search_probes 증가량을 노드 방문 횟수(비교 횟수 느낌)로 사용
         - -1 입력 시 종료
         - scanf 실패(문자 입력 등) 시 종료
     */
@@ -328,11 +440,12 @@ int main() {
         // -1이면 검색 종료
         if (search_key == -1) break;
 
-        // 검색 카운트 초기화
-        search_count = 0;
+        // 검색 전 probe 값 기억
+        long long before = op_counters.search_probes;
 
         // 검색 수행 (찾으면 element* 반환, 못 찾으면 NULL)
         result = search(T1, search_key);
+        int search_count = (int)(op_counters.search_probes - before);
 
         if (result) {
             // result가 가리키는 element의 key/value 출력
@@ -353,7 +466,7 @@ int main() {
         =========================
         - 사용자로부터 n 입력
         - make_bst(n)으로 트리 생성 시간 측정
-        - count_node / count_depth / count_leaf로 구조 관찰
+        - collect_stats 한 번의 순회로 구조 관찰 (JSON 출력 포함)
         - -1 입력 시 종료
 
         주의:
@@ -386,14 +499,16 @@ int main() {
 
         printf("이진검색트리 B의 생성시간: %.3f\n", time_taken);
 
-        // 생성된 트리의 실제 노드 수 / 높이 / 리프 수 계산
-        int node_count = count_node(B);
-        int tree_depth = count_depth(B);
-        int leaf_count = count_leaf(B);
+        // 생성된 트리의 실제 노드 수 / 높이 / 리프 수 등을 한 번에 계산
+        TreeStats st;
+        collect_stats(B, &st);
 
-        printf("이진검색트리 B의 노드 수 : %d\n", node_count);
-        printf("이진검색트리 B의 높이(깊이) : %d\n", tree_depth);
-        printf("이진검색트리 B의 단말노드 수 : %d\n\n", leaf_count);
+        printf("이진검색트리 B의 노드 수 : %d\n", st.node_count);
+        printf("이진검색트리 B의 높이(깊이) : %d\n", st.height);
+        printf("이진검색트리 B의 단말노드 수 : %d\n", st.leaf_count);
+        print_stats_json(stdout, &st, &op_counters);
+        printf("\n");
+        free_stats(&st);
 
         // 트리 메모리 해제
         delete_tree(B);
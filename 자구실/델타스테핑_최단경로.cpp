@@ -0,0 +1,555 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <queue>
+#include <chrono>
+
+/*
+    ===== 델타 스테핑 (delta-stepping) 병렬 단일 출발점 최단 경로 =====
+
+    [왜 필요한가]
+    - 인접리스트_방향_최단경로.cpp 의 다익스트라는 거리가 가장 작은 정점을
+      하나씩 꺼내 확정하므로 본질적으로 직렬 → 코어가 많아도 한 개만 사용
+
+    [아이디어 (Meyer & Sanders)]
+    - 임시 거리를 폭 delta 의 구간(버킷)으로 나눔 : 버킷 번호 = 거리 / delta
+    - 가장 작은 번호의 버킷에 든 정점들을 "한꺼번에" 스레드들이 나눠 완화
+    - 간선을 두 종류로 나눔
+        가벼운 간선 (weight <= delta) : 같은 버킷으로 다시 들어올 수 있음
+            → 버킷이 빌 때까지 반복해서 완화
+        무거운 간선 (weight >  delta) : 항상 뒤쪽 버킷으로 감
+            → 버킷이 확정된 뒤 그 버킷의 정점마다 한 번만 완화
+    - delta 가 매우 작으면 다익스트라, 매우 크면 Bellman-Ford 에 가까워짐
+
+    [병렬 구현]
+    - 거리 : 정점마다 std::atomic<long long>, 더 작은 값으로만 CAS (atomic min)
+    - 버킷 : 스레드마다 따로 가진 배열 (잠금 없이 push)
+             남아 있는 거리는 항상 [현재 버킷, 현재 버킷 + ceil(W / delta)] 안에 있으므로
+             ceil(W / delta) + 1 칸을 돌려 씀 (버킷 번호 k → 칸 k % 칸 수)
+             단계가 끝나면 모든 스레드의 현재 버킷을 공용 frontier 로 이어 붙임
+    - 스레드는 한 번만 만들고 단계 사이를 장벽(barrier)으로 동기화
+    - frontier 는 원자 커서로 조금씩 가져가므로 차수가 치우친 그래프에서도 고르게 분배
+
+    [입력]
+    - 인접리스트_방향_최단경로.cpp 와 같은 형식
+        노드 수, 에지 (from to weight) ... -1 -1 -1, 시작 노드 ... -1
+    - 실행 인자 : [스레드 수] [delta | auto] [check]
+        delta 를 생략하거나 auto 면 (최대 가중치 / 평균 차수) 로 자동 선택
+        버킷 칸 수가 BUCKET_LIMIT 을 넘는 delta (최대 가중치에 비해 너무 작은 값) 는 거부
+        check 면 직렬 다익스트라와 결과와 시간을 비교
+*/
+
+#define INF 99999                   // 도달 불가 출력 (인접리스트_방향_최단경로.cpp 와 같은 형식)
+#define UNREACHABLE LLONG_MAX       // 도달할 수 없는 정점의 거리
+#define PRINT_LIMIT 1000            // 정점이 이보다 많으면 거리 대신 요약만 출력
+#define FRONTIER_GRAIN 64           // 원자 커서로 한 번에 가져가는 frontier 정점 수
+#define BUCKET_LIMIT (1 << 20)      // 스레드마다 둘 수 있는 최대 버킷 칸 수
+#define FALSE 0
+#define TRUE 1
+
+/*
+    ===== 가중치 그래프 (CSR) =====
+    - 정점 v의 간선 : adj[offset[v]] ~ adj[offset[v + 1] - 1], 가중치는 weight[] 같은 위치
+    - 정점마다 가벼운 간선을 앞에, 무거운 간선을 뒤에 모아 둠
+        가벼운 간선 : offset[v] ~ light_end[v] - 1
+        무거운 간선 : light_end[v] ~ offset[v + 1] - 1
+    - delta 가 바뀌면 split_edges 로 다시 나눔
+*/
+typedef struct WeightedGraph {
+    int n;
+    int m;
+    int max_weight;
+    int* offset;        // 길이 n + 1
+    int* light_end;     // 길이 n
+    int* adj;           // 도착 정점, 길이 m
+    int* weight;        // 가중치, 길이 m
+} WeightedGraph;
+
+/* ===== 입력 간선 목록 (배열이 차면 2배로 확장) ===== */
+typedef struct EdgeList {
+    int m;
+    int capacity;
+    int* from;
+    int* to;
+    int* weight;
+} EdgeList;
+
+void* xmalloc(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    return p;
+}
+
+void add_edge(EdgeList* el, int from, int to, int weight) {
+    if (el->m == el->capacity) {
+        el->capacity = el->capacity ? el->capacity * 2 : 1024;
+        el->from = (int*)realloc(el->from, sizeof(int) * el->capacity);
+        el->to = (int*)realloc(el->to, sizeof(int) * el->capacity);
+        el->weight = (int*)realloc(el->weight, sizeof(int) * el->capacity);
+        if (!el->from || !el->to || !el->weight) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+    }
+    el->from[el->m] = from;
+    el->to[el->m] = to;
+    el->weight[el->m] = weight;
+    el->m++;
+}
+
+void free_edge_list(EdgeList* el) {
+    free(el->from);
+    free(el->to);
+    free(el->weight);
+    memset(el, 0, sizeof(*el));
+}
+
+/* ===== 출발 정점별로 간선 배치 (counting sort) ===== */
+void build_graph(WeightedGraph* g, int n, const EdgeList* el) {
+    int* pos;
+
+    g->n = n;
+    g->m = el->m;
+    g->max_weight = 0;
+    g->offset = (int*)xmalloc(sizeof(int) * (n + 1));
+    g->light_end = (int*)xmalloc(sizeof(int) * n);
+    g->adj = (int*)xmalloc(sizeof(int) * el->m);
+    g->weight = (int*)xmalloc(sizeof(int) * el->m);
+
+    memset(g->offset, 0, sizeof(int) * (n + 1));
+    for (int e = 0; e < el->m; e++) g->offset[el->from[e] + 1]++;
+    for (int v = 0; v < n; v++) g->offset[v + 1] += g->offset[v];
+
+    pos = (int*)xmalloc(sizeof(int) * (n + 1));
+    memcpy(pos, g->offset, sizeof(int) * (n + 1));
+    for (int e = 0; e < el->m; e++) {
+        int k = pos[el->from[e]]++;
+        g->adj[k] = el->to[e];
+        g->weight[k] = el->weight[e];
+        if (el->weight[e] > g->max_weight) g->max_weight = el->weight[e];
+    }
+    free(pos);
+}
+
+void free_graph(WeightedGraph* g) {
+    free(g->offset);
+    free(g->light_end);
+    free(g->adj);
+    free(g->weight);
+    memset(g, 0, sizeof(*g));
+}
+
+/*
+    ===== split_edges =====
+    - 정점마다 간선 구간 안에서 가벼운 간선을 앞으로 모음 (양끝 포인터 교환, O(E))
+*/
+void split_edges(WeightedGraph* g, long long delta) {
+    for (int v = 0; v < g->n; v++) {
+        int lo = g->offset[v], hi = g->offset[v + 1] - 1;
+        while (lo <= hi) {
+            if (g->weight[lo] <= delta) { lo++; continue; }
+            int t = g->adj[lo]; g->adj[lo] = g->adj[hi]; g->adj[hi] = t;
+            t = g->weight[lo]; g->weight[lo] = g->weight[hi]; g->weight[hi] = t;
+            hi--;
+        }
+        g->light_end[v] = lo;
+    }
+}
+
+/*
+    ===== auto_delta =====
+    - 가중치가 [0, W] 에 고르게 퍼져 있고 평균 차수가 d 이면
+      delta = W / d 정도에서 한 버킷의 재완화 횟수와 버킷 수가 균형을 이룸
+*/
+long long auto_delta(const WeightedGraph* g) {
+    long long avg_degree = g->n ? g->m / g->n : 0;
+    long long delta = avg_degree > 1 ? g->max_weight / avg_degree : g->max_weight;
+    return delta < 1 ? 1 : delta;
+}
+
+/*
+    ===== bucket_slots =====
+    - 순환 버킷 배열에 필요한 칸 수 = ceil(최대 가중치 / delta) + 1
+    반환: 칸 수, delta 가 1보다 작거나 BUCKET_LIMIT 을 넘으면 -1
+*/
+long long bucket_slots(const WeightedGraph* g, long long delta) {
+    if (delta < 1) return -1;
+    long long slots = (g->max_weight + delta - 1) / delta + 1;
+    return slots > BUCKET_LIMIT ? -1 : slots;
+}
+
+/*
+    ===== 스핀 장벽 =====
+    - threads 개 스레드가 모두 도착해야 다음 단계로 넘어감
+    - 세대(phase) 번호가 바뀌기를 기다리므로 같은 장벽을 계속 재사용 가능
+*/
+typedef struct SpinBarrier {
+    int threads;
+    std::atomic<int> waiting;
+    std::atomic<int> phase;
+} SpinBarrier;
+
+void barrier_wait(SpinBarrier* b) {
+    int phase = b->phase.load(std::memory_order_acquire);
+    if (b->waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == b->threads) {
+        b->waiting.store(0, std::memory_order_relaxed);
+        b->phase.fetch_add(1, std::memory_order_release);
+        return;
+    }
+    while (b->phase.load(std::memory_order_acquire) == phase)
+        std::this_thread::yield();
+}
+
+/* ===== 더 작은 값일 때만 거리 갱신 (atomic min), 갱신했으면 TRUE ===== */
+int relax_min(std::atomic<long long>* d, long long nd) {
+    long long old = d->load(std::memory_order_relaxed);
+    while (nd < old)
+        if (d->compare_exchange_weak(old, nd, std::memory_order_relaxed))
+            return TRUE;
+    return FALSE;
+}
+
+/* ===== 델타 스테핑 공용 상태 ===== */
+typedef std::vector<std::vector<int> > Buckets;     // 버킷 칸 (번호 % slots) → 정점 목록
+
+typedef struct DeltaStepping {
+    const WeightedGraph* g;
+    long long delta;
+    long long slots;                            // 순환 버킷 칸 수
+    int threads;
+    std::atomic<long long>* dist;
+    std::atomic<unsigned char>* settled;        // 무거운 간선을 완화할 정점으로 이미 모았는지
+    std::vector<Buckets> bins;                  // 스레드별 버킷
+    std::vector<std::vector<int> > done;        // 스레드별 현재 버킷에서 처리한 정점
+    std::vector<int> frontier;                  // 현재 버킷의 정점 (모든 스레드 것을 합침)
+    std::vector<size_t> place;                  // frontier 에 이어 붙일 스레드별 시작 위치
+    std::atomic<size_t> cursor;
+    long long current;                          // 현재 버킷 번호
+    int heavy;                                  // 현재 버킷이 비었는지 (무거운 간선 단계)
+    int finished;
+    SpinBarrier barrier;
+} DeltaStepping;
+
+/* 버킷 번호 k 가 쓰는 칸 */
+size_t bucket_slot(const DeltaStepping* s, long long k) {
+    return (size_t)(k % s->slots);
+}
+
+/* 정점 v를 거리 nd 의 버킷에 넣음 (tid 스레드 전용 배열) */
+void push_bucket(DeltaStepping* s, int tid, int v, long long nd) {
+    Buckets& b = s->bins[tid];
+    size_t k = bucket_slot(s, nd / s->delta);
+    if (k >= b.size()) b.resize(k + 1);
+    b[k].push_back(v);
+}
+
+/*
+    tid 0 전용 : 모든 스레드의 current 버킷 크기로 frontier 위치를 정함
+    반환값 : 이어 붙인 뒤 frontier 크기
+*/
+size_t plan_gather(DeltaStepping* s) {
+    size_t total = 0, k = bucket_slot(s, s->current);
+    for (int t = 0; t < s->threads; t++) {
+        const Buckets& b = s->bins[t];
+        s->place[t] = total;
+        if (k < b.size()) total += b[k].size();
+    }
+    s->frontier.resize(total);
+    s->cursor.store(0, std::memory_order_relaxed);
+    return total;
+}
+
+/* 각 스레드가 자기 current 버킷을 frontier 의 정해진 자리로 복사 */
+void gather(DeltaStepping* s, int tid) {
+    Buckets& b = s->bins[tid];
+    size_t k = bucket_slot(s, s->current);
+    if (k >= b.size()) return;
+    std::vector<int>& mine = b[k];
+    if (!mine.empty())
+        memcpy(&s->frontier[s->place[tid]], &mine[0], sizeof(int) * mine.size());
+    mine.clear();
+}
+
+void delta_worker(DeltaStepping* s, int tid) {
+    const WeightedGraph* g = s->g;
+    std::vector<int>& done = s->done[tid];
+
+    while (1) {
+        /* 1) 가벼운 간선 완화 : frontier 를 FRONTIER_GRAIN 개씩 가져가 처리 */
+        size_t size = s->frontier.size();
+        while (1) {
+            size_t b = s->cursor.fetch_add(FRONTIER_GRAIN, std::memory_order_relaxed);
+            if (b >= size) break;
+            size_t e = b + FRONTIER_GRAIN < size ? b + FRONTIER_GRAIN : size;
+            for (size_t i = b; i < e; i++) {
+                int v = s->frontier[i];
+                long long dv = s->dist[v].load(std::memory_order_relaxed);
+                if (dv / s->delta != s->current) continue;     // 더 앞 버킷에서 이미 처리된 낡은 항목
+                if (!s->settled[v].exchange(1, std::memory_order_relaxed))
+                    done.push_back(v);
+                for (int k = g->offset[v]; k < g->light_end[v]; k++) {
+                    long long nd = dv + g->weight[k];
+                    if (relax_min(&s->dist[g->adj[k]], nd))
+                        push_bucket(s, tid, g->adj[k], nd);
+                }
+            }
+        }
+        barrier_wait(&s->barrier);
+
+        /* 2) 현재 버킷에 다시 들어온 정점이 있으면 가벼운 간선 단계를 반복 */
+        if (tid == 0) s->heavy = plan_gather(s) == 0;
+        barrier_wait(&s->barrier);
+        if (!s->heavy) {
+            gather(s, tid);
+            barrier_wait(&s->barrier);
+            continue;
+        }
+
+        /* 3) 버킷 확정 → 이 버킷에서 처리한 정점의 무거운 간선을 한 번씩 완화 */
+        for (size_t i = 0; i < done.size(); i++) {
+            int v = done[i];
+            long long dv = s->dist[v].load(std::memory_order_relaxed);
+            for (int k = g->light_end[v]; k < g->offset[v + 1]; k++) {
+                long long nd = dv + g->weight[k];
+                if (relax_min(&s->dist[g->adj[k]], nd))
+                    push_bucket(s, tid, g->adj[k], nd);
+            }
+        }
+        done.clear();
+        barrier_wait(&s->barrier);
+
+        /* 4) 모든 스레드에서 비어 있지 않은 가장 앞 버킷으로 이동 (현재 다음 칸부터 한 바퀴) */
+        if (tid == 0) {
+            long long next = -1;
+            for (long long k = s->current + 1; k < s->current + s->slots && next == -1; k++) {
+                size_t slot = bucket_slot(s, k);
+                for (int t = 0; t < s->threads; t++) {
+                    const Buckets& b = s->bins[t];
+                    if (slot < b.size() && !b[slot].empty()) { next = k; break; }
+                }
+            }
+            s->finished = next == -1;
+            if (!s->finished) {
+                s->current = next;
+                plan_gather(s);
+            }
+        }
+        barrier_wait(&s->barrier);
+        if (s->finished) break;
+        gather(s, tid);
+        barrier_wait(&s->barrier);
+    }
+}
+
+/*
+    ===== delta_stepping =====
+    - distance[v] : start 에서 v까지의 최단 거리 (도달 불가면 UNREACHABLE)
+    - g 의 가벼운/무거운 간선은 split_edges(g, delta) 로 미리 나눠 두어야 함
+    반환: 성공 0, 음수 가중치가 있거나 delta 에 맞는 버킷 칸 수가 BUCKET_LIMIT 을 넘으면 -1
+*/
+int delta_stepping(const WeightedGraph* g, int start, long long delta, int threads,
+                   long long* distance) {
+    DeltaStepping s;
+
+    for (int k = 0; k < g->m; k++) {
+        if (g->weight[k] < 0) {
+            fprintf(stderr, "음수 가중치 (%d) : 델타 스테핑을 쓸 수 없음\n", g->weight[k]);
+            return -1;
+        }
+    }
+
+    s.slots = bucket_slots(g, delta);
+    if (s.slots < 0) {
+        fprintf(stderr, "delta %lld 가 최대 가중치 %d 에 비해 너무 작음 (버킷 칸 %d개 초과)\n",
+                delta, g->max_weight, BUCKET_LIMIT);
+        return -1;
+    }
+
+    s.g = g;
+    s.delta = delta;
+    s.threads = threads;
+    s.dist = new std::atomic<long long>[g->n + 1];
+    s.settled = new std::atomic<unsigned char>[g->n + 1];
+    s.bins.resize(threads);
+    s.done.resize(threads);
+    s.place.resize(threads);
+    s.current = 0;
+    s.heavy = s.finished = FALSE;
+    s.barrier.threads = threads;
+    s.barrier.waiting.store(0);
+    s.barrier.phase.store(0);
+
+    for (int v = 0; v < g->n; v++) {
+        s.dist[v].store(UNREACHABLE, std::memory_order_relaxed);
+        s.settled[v].store(0, std::memory_order_relaxed);
+    }
+    s.dist[start].store(0, std::memory_order_relaxed);
+    s.frontier.assign(1, start);
+    s.cursor.store(0);
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++)
+        pool.emplace_back(delta_worker, &s, t);
+    delta_worker(&s, 0);
+    for (auto& th : pool) th.join();
+
+    for (int v = 0; v < g->n; v++)
+        distance[v] = s.dist[v].load(std::memory_order_relaxed);
+    delete[] s.dist;
+    delete[] s.settled;
+    return 0;
+}
+
+/*
+    ===== dijkstra_serial (검증/비교용) =====
+    - 이진 힙 다익스트라 (낡은 항목은 꺼낼 때 건너뜀)
+*/
+void dijkstra_serial(const WeightedGraph* g, int start, long long* distance) {
+    typedef std::pair<long long, int> Item;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item> > pq;
+
+    for (int v = 0; v < g->n; v++) distance[v] = UNREACHABLE;
+    distance[start] = 0;
+    pq.push(Item(0, start));
+    while (!pq.empty()) {
+        Item top = pq.top();
+        pq.pop();
+        int u = top.second;
+        if (top.first != distance[u]) continue;
+        for (int k = g->offset[u]; k < g->offset[u + 1]; k++) {
+            long long nd = top.first + g->weight[k];
+            if (nd < distance[g->adj[k]]) {
+                distance[g->adj[k]] = nd;
+                pq.push(Item(nd, g->adj[k]));
+            }
+        }
+    }
+}
+
+double seconds_since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t).count();
+}
+
+/* ===== 거리 출력 (정점이 많으면 요약) ===== */
+void print_distance(const long long* distance, int n) {
+    if (n <= PRINT_LIMIT) {
+        printf("Distance : ");
+        for (int i = 0; i < n; i++) {
+            if (distance[i] == UNREACHABLE) printf("%3d ", INF);
+            else printf("%3lld ", distance[i]);
+        }
+        printf("\n");
+        return;
+    }
+
+    int reached = 0;
+    long long farthest = 0;
+    for (int i = 0; i < n; i++) {
+        if (distance[i] == UNREACHABLE) continue;
+        reached++;
+        if (distance[i] > farthest) farthest = distance[i];
+    }
+    printf("도달 %d개, 최대 거리 %lld\n", reached, farthest);
+}
+
+/*
+    ===== main =====
+    - 실행 인자 : [스레드 수] [delta | auto] [check]
+*/
+int main(int argc, char** argv) {
+    EdgeList el;
+    WeightedGraph g;
+    int n, from, to, w, start;
+    int threads = (int)std::thread::hardware_concurrency();
+    long long delta = 0;        // 0 : 자동 선택
+    int check = FALSE, numbers = 0;
+
+    if (threads < 1) threads = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "check") == 0) check = TRUE;
+        else if (strcmp(argv[i], "auto") == 0 && numbers <= 1) numbers = 2;
+        else if (numbers == 0 && atoi(argv[i]) > 0) { threads = atoi(argv[i]); numbers++; }
+        else if (numbers == 1 && atoll(argv[i]) > 0) { delta = atoll(argv[i]); numbers++; }
+        else {
+            fprintf(stderr, "사용법: %s [스레드 수] [delta | auto] [check]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    memset(&el, 0, sizeof(el));
+
+    printf("11.1. 방향성 가중치 그래프 생성\n");
+    printf("노드 수 (n) : ");
+    if (scanf("%d", &n) != 1 || n <= 0)
+        return 0;
+
+    while (1) {
+        printf("에지 정보 (from to weight) : ");
+        if (scanf("%d %d %d", &from, &to, &w) != 3)
+            return 0;
+        if (from == -1 && to == -1 && w == -1)
+            break;
+        if (from < 0 || to < 0 || from >= n || to >= n) {
+            fprintf(stderr, "정점 번호 오류\n");
+            continue;
+        }
+        add_edge(&el, from, to, w);
+    }
+
+    build_graph(&g, n, &el);
+    free_edge_list(&el);
+    if (delta == 0) delta = auto_delta(&g);
+    if (bucket_slots(&g, delta) < 0) {
+        fprintf(stderr, "delta %lld 가 최대 가중치 %d 에 비해 너무 작음 (버킷 칸 %d개 초과)\n",
+                delta, g.max_weight, BUCKET_LIMIT);
+        free_graph(&g);
+        return 1;
+    }
+    split_edges(&g, delta);
+
+    printf("\n11.2. 최단 경로 (단일 출발점, 델타 스테핑 : 스레드 %d개, delta %lld)\n",
+           threads, delta);
+    long long* distance = (long long*)xmalloc(sizeof(long long) * (n + 1));
+    long long* expected = (long long*)xmalloc(sizeof(long long) * (n + 1));
+    while (1) {
+        printf("시작 노드 (v) : ");
+        if (scanf("%d", &start) != 1 || start == -1)
+            break;
+        if (start < 0 || start >= n) {
+            fprintf(stderr, "정점 번호 오류\n");
+            continue;
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        if (delta_stepping(&g, start, delta, threads, distance) != 0)
+            continue;
+        double parallel_sec = seconds_since(t0);
+        print_distance(distance, n);
+
+        if (check) {
+            t0 = std::chrono::steady_clock::now();
+            dijkstra_serial(&g, start, expected);
+            double serial_sec = seconds_since(t0);
+
+            int errors = 0;
+            for (int v = 0; v < n; v++)
+                if (distance[v] != expected[v]) errors++;
+            if (errors) printf("  검증 : 정점 %d개의 거리가 다익스트라와 다름\n", errors);
+            else printf("  검증 : 통과 (델타 스테핑 %.3f초, 직렬 다익스트라 %.3f초)\n",
+                        parallel_sec, serial_sec);
+        }
+    }
+
+    free(distance);
+    free(expected);
+    free_graph(&g);
+    return 0;
+}
@@ -2,7 +2,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#define MAX_VERTICES 100
 #define FALSE 0
 #define TRUE 1
 
@@ -12,27 +11,71 @@ typedef struct node {
     struct node* link;
 } Node;
 
-Node* graph[MAX_VERTICES];
-short int visited[MAX_VERTICES];
+/* 정점 수 제한 없음: 실행 중에 필요한 만큼 할당 */
+Node** graph = NULL;
+short int* visited = NULL;
 int n;
-
-/* ===== 큐 구조체 (BFS용) ===== */
-typedef struct queue {
-    int vertex;
-    struct queue* link;
-} Queue;
+int capacity = 0;   // graph / visited 에 할당된 칸 수
+
+/*
+    ===== BFS용 배열 큐 =====
+    - 정점 수(capacity) 크기로 미리 할당해 두고 grow_graph 에서 함께 확장
+    - 한 번의 BFS 에서 각 정점은 최대 한 번만 들어가므로
+      front / rear 인덱스만 앞으로 움직이면 넘칠 일이 없음
+    - 예전처럼 정점마다 큐 노드를 calloc / free 하지 않음
+*/
+int* queue = NULL;
+
+/* ===== DFS용 명시적 스택 (정점, 다음에 확인할 인접 노드) =====
+   재귀 깊이 제한 없이 긴 경로 그래프도 탐색, grow_graph 에서 함께 확장 */
+int* stack_v = NULL;
+Node** stack_p = NULL;
+
+/* ===== DFS 방문 시각 (pre: 처음 방문, post: 되돌아갈 때) ===== */
+int* pre_order = NULL;
+int* post_order = NULL;
+int dfs_clock = 0;
+
+/* ===== 그래프 배열 확장 =====
+   정점 v까지 담을 수 있도록 graph / visited 를 2배씩 늘림 */
+void grow_graph(int v) {
+    int i, new_capacity;
+
+    if (v >= n) n = v + 1;
+    if (v < capacity) return;
+
+    new_capacity = capacity ? capacity : 16;
+    while (new_capacity <= v) new_capacity *= 2;
+
+    graph = (Node**)realloc(graph, sizeof(Node*) * new_capacity);
+    visited = (short int*)realloc(visited, sizeof(short int) * new_capacity);
+    queue = (int*)realloc(queue, sizeof(int) * new_capacity);
+    stack_v = (int*)realloc(stack_v, sizeof(int) * new_capacity);
+    stack_p = (Node**)realloc(stack_p, sizeof(Node*) * new_capacity);
+    pre_order = (int*)realloc(pre_order, sizeof(int) * new_capacity);
+    post_order = (int*)realloc(post_order, sizeof(int) * new_capacity);
+    if (!graph || !visited || !queue || !stack_v || !stack_p || !pre_order || !post_order) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (i = capacity; i < new_capacity; i++) {
+        graph[i] = NULL;
+        visited[i] = FALSE;
+    }
+    capacity = new_capacity;
+}
 
 /* ===== 그래프 초기화 ===== */
 void init_graph(int n) {
-    int i;
-    for (i = 0; i < n; i++)
-        graph[i] = NULL;
+    if (n > 0) grow_graph(n - 1);
 }
 
 /* ===== 간선 삽입 (무방향 그래프) ===== */
 void insert_edge(int u, int v) {
     Node* p;
 
+    grow_graph(u > v ? u : v);
+
     p = (Node*)calloc(1, sizeof(Node));
     p->vertex = v;
     p->link = graph[u];
@@ -44,30 +87,13 @@ void insert_edge(int u, int v) {
     graph[v] = p;
 }
 
-/* ===== 큐 연산 ===== */
-void addq(Queue** front, Queue** rear, int v) {
-    Queue* temp = (Queue*)calloc(1, sizeof(Queue));
-    temp->vertex = v;
-    temp->link = NULL;
-
-    if (*rear)
-        (*rear)->link = temp;
-    else
-        *front = temp;
-
-    *rear = temp;
+/* ===== 큐 연산 (배열 인덱스만 이동, O(1)) ===== */
+void addq(int* rear, int v) {
+    queue[(*rear)++] = v;
 }
 
-int deleteq(Queue** front, Queue** rear) {
-    Queue* temp = *front;
-    int v = temp->vertex;
-
-    *front = temp->link;
-    if (*front == NULL)
-        *rear = NULL;
-
-    free(temp);
-    return v;
+int deleteq(int* front) {
+    return queue[(*front)++];
 }
 
 /* ===== 그래프 출력 및 degree 계산 ===== */
@@ -100,34 +126,61 @@ void print_graph_and_degree(void) {
     printf(" end\n");
 }
 
-/* ===== DFS ===== */
-void dfs(int v) {
+/* ===== DFS 공용 (명시적 스택, 재귀 DFS와 같은 방문 순서) =====
+   print_edges 가 TRUE면 신장트리 간선, FALSE면 방문 정점 출력
+   pre_order / post_order 에 방문 시각 기록 */
+void dfs_common(int start, int print_edges) {
+    int top = 0, v;
     Node* w;
-    visited[v] = TRUE;
-    printf("%5d", v);
 
-    for (w = graph[v]; w; w = w->link) {
-        if (!visited[w->vertex])
-            dfs(w->vertex);
+    dfs_clock = 0;
+    visited[start] = TRUE;
+    pre_order[start] = dfs_clock++;
+    if (!print_edges) printf("%5d", start);
+    stack_v[top] = start;
+    stack_p[top++] = graph[start];
+
+    while (top) {
+        v = stack_v[top - 1];
+        for (w = stack_p[top - 1]; w && visited[w->vertex]; w = w->link);
+
+        if (!w) {   // 더 갈 곳이 없으면 되돌아감
+            post_order[v] = dfs_clock++;
+            top--;
+            continue;
+        }
+
+        stack_p[top - 1] = w->link;
+        visited[w->vertex] = TRUE;
+        pre_order[w->vertex] = dfs_clock++;
+        if (print_edges) printf("  (%d, %d)", v, w->vertex);
+        else printf("%5d", w->vertex);
+        stack_v[top] = w->vertex;
+        stack_p[top++] = graph[w->vertex];
     }
 }
 
+/* ===== DFS ===== */
+void dfs(int v) {
+    dfs_common(v, FALSE);
+}
+
 /* ===== BFS ===== */
 void bfs(int v) {
     Node* w;
-    Queue* front = NULL, * rear = NULL;
+    int front = 0, rear = 0;
 
     visited[v] = TRUE;
     printf("%5d", v);
-    addq(&front, &rear, v);
+    addq(&rear, v);
 
-    while (front) {
-        v = deleteq(&front, &rear);
+    while (front < rear) {
+        v = deleteq(&front);
         for (w = graph[v]; w; w = w->link) {
             if (!visited[w->vertex]) {
                 visited[w->vertex] = TRUE;
                 printf("%5d", w->vertex);
-                addq(&front, &rear, w->vertex);
+                addq(&rear, w->vertex);
             }
         }
     }
@@ -135,33 +188,25 @@ void bfs(int v) {
 
 /* ===== DFS 신장트리 ===== */
 void dfs_spanning(int v) {
-    Node* w;
-    visited[v] = TRUE;
-
-    for (w = graph[v]; w; w = w->link) {
-        if (!visited[w->vertex]) {
-            printf("  (%d, %d)", v, w->vertex);
-            dfs_spanning(w->vertex);
-        }
-    }
+    dfs_common(v, TRUE);
 }
 
 /* ===== BFS 신장트리 ===== */
 void bfs_spanning(int start) {
     Node* w;
     int v;
-    Queue* front = NULL, * rear = NULL;
+    int front = 0, rear = 0;
 
     visited[start] = TRUE;
-    addq(&front, &rear, start);
+    addq(&rear, start);
 
-    while (front) {
-        v = deleteq(&front, &rear);
+    while (front < rear) {
+        v = deleteq(&front);
         for (w = graph[v]; w; w = w->link) {
             if (!visited[w->vertex]) {
                 visited[w->vertex] = TRUE;
                 printf("  (%d, %d)", v, w->vertex);  // 신장트리 간선
-                addq(&front, &rear, w->vertex);
+                addq(&rear, w->vertex);
             }
         }
     }
@@ -181,6 +226,21 @@ void free_graph(void) {
         }
         graph[i] = NULL;
     }
+    free(graph);
+    free(visited);
+    free(queue);
+    free(stack_v);
+    free(stack_p);
+    free(pre_order);
+    free(post_order);
+    graph = NULL;
+    visited = NULL;
+    queue = NULL;
+    stack_v = NULL;
+    stack_p = NULL;
+    pre_order = NULL;
+    post_order = NULL;
+    n = capacity = 0;
 }
 
 /* ===== main ===== */
@@ -189,7 +249,7 @@ int main(void) {
 
     printf("10.1. 인접 리스트 형태의 무방향성 그래프 생성\n");
     printf("  노드 개수(n): ");
-    if (scanf("%d", &n) != 1)
+    if (scanf("%d", &n) != 1 || n <= 0)
         return 0;
 
     init_graph(n);
@@ -200,6 +260,8 @@ int main(void) {
             return 0;
         if (u == -1 && v == -1)
             break;
+        if (u < 0 || v < 0)
+            continue;
         insert_edge(u, v);
     }
 
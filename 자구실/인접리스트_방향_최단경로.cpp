@@ -1,8 +1,12 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
-#define MAX_VERTICES 100
 #define INF 99999
 #define FALSE 0
 #define TRUE 1
@@ -17,27 +21,40 @@ typedef struct node {
 /* ===== 그래프 ===== */
 typedef struct GraphType {
     int n;                  // 정점 개수
-    Node* adj_list[MAX_VERTICES];
+    int capacity;           // adj_list 에 할당된 칸 수 (정점 수 제한 없음)
+    Node** adj_list;
 } GraphType;
 
 /* ===== 그래프 초기화 ===== */
 void init(GraphType* g) {
     g->n = 0;
-    for (int i = 0; i < MAX_VERTICES; i++)
-        g->adj_list[i] = NULL;
+    g->capacity = 0;
+    g->adj_list = NULL;
 }
 
-/* ===== 정점 삽입 ===== */
+/* ===== 정점 삽입 (배열이 차면 2배로 확장) ===== */
 void insert_vertex(GraphType* g, int v) {
-    if (g->n >= MAX_VERTICES) {
-        printf("정점 개수 초과\n");
-        return;
+    (void)v;    // 정점 번호는 항상 g->n (순서대로 추가)
+    if (g->n == g->capacity) {
+        int new_capacity = g->capacity ? g->capacity * 2 : 16;
+        g->adj_list = (Node**)realloc(g->adj_list, sizeof(Node*) * new_capacity);
+        if (!g->adj_list) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+        for (int i = g->capacity; i < new_capacity; i++)
+            g->adj_list[i] = NULL;
+        g->capacity = new_capacity;
     }
     g->n++;
 }
 
 /* ===== 간선 삽입 (방향 그래프) ===== */
 void insert_edge(GraphType* g, int from, int to, int weight) {
+    if (from < 0 || to < 0 || from >= g->n || to >= g->n) {
+        fprintf(stderr, "정점 번호 오류\n");
+        return;
+    }
     Node* p = (Node*)malloc(sizeof(Node));
     p->vertex = to;
     p->weight = weight;
@@ -58,55 +75,914 @@ void print_graph(GraphType* g) {
     }
 }
 
-/* ===== 최소 거리 정점 선택 ===== */
-int choose(int distance[], int n, short int found[]) {
-    int min = INF;
-    int minpos = -1;
+/*
+    ===== 배열 형태의 그래프 (CSR) =====
+    - 인접 리스트를 한 번 훑어 연속 배열로 옮긴 것
+        정점 v의 간선 : adj[offset[v]] ~ adj[offset[v + 1] - 1], 가중치는 weight[] 같은 위치
+    - 포인터를 따라가지 않으므로 큰 그래프를 여러 번 훑는 분석에서 캐시 효율이 좋음
+    - 간선 순서는 인접 리스트 순서와 같음
+*/
+typedef struct CompactGraph {
+    int n;
+    int m;
+    int* offset;    // 길이 n + 1
+    int* adj;       // 도착 정점, 길이 m
+    int* weight;    // 가중치, 길이 m
+} CompactGraph;
+
+void build_compact(GraphType* g, CompactGraph* c) {
+    Node* p;
+    int i, k = 0;
+
+    c->n = g->n;
+    c->m = 0;
+    for (i = 0; i < g->n; i++)
+        for (p = g->adj_list[i]; p; p = p->link) c->m++;
+
+    c->offset = (int*)malloc(sizeof(int) * (c->n + 1));
+    c->adj = (int*)malloc(sizeof(int) * (c->m ? c->m : 1));
+    c->weight = (int*)malloc(sizeof(int) * (c->m ? c->m : 1));
+    if (!c->offset || !c->adj || !c->weight) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (i = 0; i < g->n; i++) {
+        c->offset[i] = k;
+        for (p = g->adj_list[i]; p; p = p->link) {
+            c->adj[k] = p->vertex;
+            c->weight[k++] = p->weight;
+        }
+    }
+    c->offset[c->n] = k;
+}
+
+void free_compact(CompactGraph* c) {
+    free(c->offset);
+    free(c->adj);
+    free(c->weight);
+    c->offset = c->adj = c->weight = NULL;
+    c->n = c->m = 0;
+}
+
+/*
+    ===== 강연결 요소 (SCC, 반복형 Tarjan) =====
+    - 서로 오갈 수 있는 정점들의 최대 집합
+    - disc[v] : 방문 순서, low[v] : v의 서브트리에서 스택에 남아 있는 정점으로 닿는 가장 작은 disc
+    - v의 이웃을 모두 본 뒤 low[v] == disc[v] 이면
+      SCC 스택에서 v까지 꺼낸 정점들이 하나의 SCC
+    - 재귀 대신 (정점, 다음 간선 위치) 스택을 써서 긴 경로에서도 안전, O(V + E)
+
+    결과:
+    - comp[v] : 정점 v의 SCC 번호 (위상 정렬의 역순으로 0, 1, 2, ...)
+    - 반환값  : SCC 개수
+*/
+int strongly_connected_components(const CompactGraph* c, int* comp) {
+    int n = c->n;
+    int* disc = (int*)malloc(sizeof(int) * (n + 1));
+    int* low = (int*)malloc(sizeof(int) * (n + 1));
+    int* call_v = (int*)malloc(sizeof(int) * (n + 1));    // DFS 스택 (정점)
+    int* call_k = (int*)malloc(sizeof(int) * (n + 1));    // DFS 스택 (다음 간선 위치)
+    int* scc_stack = (int*)malloc(sizeof(int) * (n + 1));
+    short int* on_stack = (short int*)malloc(sizeof(short int) * (n + 1));
+    int timer = 0, count = 0, sp = 0;
 
+    if (!disc || !low || !call_v || !call_k || !scc_stack || !on_stack) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
     for (int i = 0; i < n; i++) {
-        if (distance[i] < min && !found[i]) {
-            min = distance[i];
-            minpos = i;
+        disc[i] = -1;
+        on_stack[i] = FALSE;
+    }
+
+    for (int r = 0; r < n; r++) {
+        int top = 0;
+        if (disc[r] != -1) continue;
+
+        disc[r] = low[r] = timer++;
+        scc_stack[sp++] = r;
+        on_stack[r] = TRUE;
+        call_v[top] = r;
+        call_k[top++] = c->offset[r];
+
+        while (top) {
+            int v = call_v[top - 1];
+            int k = call_k[top - 1];
+
+            if (k < c->offset[v + 1]) {
+                int w = c->adj[k];
+                call_k[top - 1] = k + 1;
+                if (disc[w] == -1) {            // 트리 간선 → 내려감
+                    disc[w] = low[w] = timer++;
+                    scc_stack[sp++] = w;
+                    on_stack[w] = TRUE;
+                    call_v[top] = w;
+                    call_k[top++] = c->offset[w];
+                }
+                else if (on_stack[w] && disc[w] < low[v]) {
+                    low[v] = disc[w];
+                }
+                continue;
+            }
+
+            // v 완료: SCC 의 뿌리면 스택에서 꺼내 번호를 붙임
+            if (low[v] == disc[v]) {
+                int w;
+                do {
+                    w = scc_stack[--sp];
+                    on_stack[w] = FALSE;
+                    comp[w] = count;
+                } while (w != v);
+                count++;
+            }
+            top--;
+            if (top && low[v] < low[call_v[top - 1]])
+                low[call_v[top - 1]] = low[v];
         }
     }
-    return minpos;
+
+    free(disc);
+    free(low);
+    free(call_v);
+    free(call_k);
+    free(scc_stack);
+    free(on_stack);
+    return count;
+}
+
+/* ===== SCC 출력 ===== */
+void print_scc(GraphType* g) {
+    CompactGraph c;
+    int* comp = (int*)malloc(sizeof(int) * (g->n + 1));
+    int count;
+
+    build_compact(g, &c);
+    count = strongly_connected_components(&c, comp);
+
+    // 요소별로 정점 모으기 (counting sort, O(V))
+    int* start = (int*)calloc(count + 1, sizeof(int));
+    int* members = (int*)malloc(sizeof(int) * (g->n + 1));
+    for (int i = 0; i < g->n; i++) start[comp[i] + 1]++;
+    for (int s = 0; s < count; s++) start[s + 1] += start[s];
+    for (int i = 0; i < g->n; i++) members[start[comp[i]]++] = i;
+
+    printf("\n강연결 요소 (SCC) : %d개\n", count);
+    for (int s = count - 1; s >= 0; s--) {     // 위상 순서 (간선이 앞 → 뒤 요소로만 향함)
+        printf("  {");
+        for (int i = s ? start[s - 1] : 0; i < start[s]; i++)  // 채운 뒤 start[s] 는 요소 s의 끝
+            printf(" %d", members[i]);
+        printf(" }\n");
+    }
+
+    free(start);
+    free(members);
+    free(comp);
+    free_compact(&c);
+}
+
+/*
+    ===== 우선순위 큐 다익스트라 =====
+
+    [기존 방식의 문제]
+    - choose() 가 매번 모든 정점의 distance 를 훑음 → O(V^2)
+      인접 리스트를 써도 정점이 수백만 개면 끝나지 않음
+
+    [우선순위 큐 사용]
+    - 아직 확정되지 않은 정점을 거리 순으로 꺼냄 → O((V + E) log V)
+    - 큐 종류 (main 의 실행 인자로 선택)
+        PQ_BINARY     : 이진 힙 + decrease-key
+        PQ_QUATERNARY : 4진 힙 + decrease-key
+                        (높이가 절반 → 거리 갱신(sift up)이 많은 그래프에서 유리)
+        PQ_RADIX      : 기수 힙 (정수 가중치 전용, 단조 큐)
+    - 가중치는 0 이상이어야 함
+*/
+#define PQ_BINARY     1
+#define PQ_QUATERNARY 2
+#define PQ_RADIX      3
+#define UNREACHABLE   LLONG_MAX // 도달할 수 없는 정점의 거리 (11장.cpp 등 다른 최단 경로 구현과 같은 값)
+
+/*
+    ===== d진 힙 (정점 번호를 담는 최소 힙) =====
+    - heap[i] 의 자식 : heap[d*i + 1] ~ heap[d*i + d]
+    - pos[v] : 힙 안에서 정점 v의 위치 (없으면 -1)
+      → 거리가 줄어든 정점을 바로 찾아 위로 올릴 수 있음 (decrease-key)
+    - 키는 key[v] (= 현재 distance) 를 그대로 참조
+*/
+typedef struct DaryHeap {
+    int d;                  // 자식 수 (2: 이진 힙, 4: 4진 힙)
+    int size;
+    int* heap;
+    int* pos;
+    const long long* key;
+} DaryHeap;
+
+void init_dary_heap(DaryHeap* h, int d, int n, const long long* key) {
+    h->d = d;
+    h->size = 0;
+    h->heap = (int*)malloc(sizeof(int) * (n + 1));
+    h->pos = (int*)malloc(sizeof(int) * (n + 1));
+    h->key = key;
+    if (!h->heap || !h->pos) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) h->pos[i] = -1;
+}
+
+void free_dary_heap(DaryHeap* h) {
+    free(h->heap);
+    free(h->pos);
+}
+
+/* i 위치의 정점을 부모보다 작은 동안 위로 올림 */
+void dary_sift_up(DaryHeap* h, int i) {
+    int v = h->heap[i];
+    while (i > 0) {
+        int parent = (i - 1) / h->d;
+        if (h->key[h->heap[parent]] <= h->key[v]) break;
+        h->heap[i] = h->heap[parent];
+        h->pos[h->heap[i]] = i;
+        i = parent;
+    }
+    h->heap[i] = v;
+    h->pos[v] = i;
+}
+
+/* i 위치의 정점을 가장 작은 자식보다 큰 동안 아래로 내림 */
+void dary_sift_down(DaryHeap* h, int i) {
+    int v = h->heap[i];
+    while (1) {
+        int first = h->d * i + 1, best = -1;
+        for (int c = first; c < first + h->d && c < h->size; c++)
+            if (best < 0 || h->key[h->heap[c]] < h->key[h->heap[best]]) best = c;
+        if (best < 0 || h->key[h->heap[best]] >= h->key[v]) break;
+        h->heap[i] = h->heap[best];
+        h->pos[h->heap[i]] = i;
+        i = best;
+    }
+    h->heap[i] = v;
+    h->pos[v] = i;
+}
+
+/* 처음 들어오는 정점은 삽입, 이미 있으면 줄어든 키에 맞게 위로 (decrease-key) */
+void dary_push_or_decrease(DaryHeap* h, int v) {
+    if (h->pos[v] < 0) {
+        h->heap[h->size] = v;
+        h->pos[v] = h->size;
+        h->size++;
+    }
+    dary_sift_up(h, h->pos[v]);
 }
 
-/* ===== 다익스트라 (인접 리스트) ===== */
-void dijkstra(GraphType* g, int start) {
-    int distance[MAX_VERTICES];
-    short int found[MAX_VERTICES];
+int dary_pop(DaryHeap* h) {
+    int top = h->heap[0];
+    h->pos[top] = -1;
+    if (--h->size > 0) {
+        h->heap[0] = h->heap[h->size];
+        dary_sift_down(h, 0);
+    }
+    return top;
+}
+
+/*
+    ===== 기수 힙 (radix heap) =====
+    - 다익스트라처럼 꺼내는 키가 줄어들지 않는(단조) 경우에만 쓸 수 있는 정수 키 큐
+    - last : 마지막으로 꺼낸 키
+    - 키 k는 (k XOR last) 의 가장 높은 1비트 위치에 따라 버킷에 들어감
+        버킷 0 : k == last,  버킷 b : 가장 높은 다른 비트가 b-1
+    - 버킷 0이 비면 처음으로 비지 않은 버킷의 최솟값을 last 로 삼고
+      그 버킷의 원소를 다시 나눠 담음 → 원소마다 버킷 번호가 줄어들기만 하므로
+      원소 하나당 최대 64번 이동 (키 크기에 대한 로그 시간)
+    - decrease-key 대신 같은 정점을 새 키로 다시 넣고, 꺼낼 때 낡은 항목은 무시
+*/
+#define RADIX_BUCKETS 65
+
+typedef struct RadixBucket {
+    unsigned long long* key;
+    int* vertex;
+    int count;
+    int capacity;
+} RadixBucket;
+
+typedef struct RadixHeap {
+    unsigned long long last;
+    long long size;
+    RadixBucket bucket[RADIX_BUCKETS];
+} RadixHeap;
+
+/* 0이 아닌 x의 가장 높은 1비트 위치 (0 ~ 63) */
+int highest_bit(unsigned long long x) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanReverse64(&i, x);
+    return (int)i;
+#else
+    return 63 - __builtin_clzll(x);
+#endif
+}
+
+void init_radix_heap(RadixHeap* h) {
+    memset(h, 0, sizeof(*h));
+}
+
+void free_radix_heap(RadixHeap* h) {
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        free(h->bucket[b].key);
+        free(h->bucket[b].vertex);
+    }
+}
+
+void bucket_add(RadixBucket* b, unsigned long long key, int v) {
+    if (b->count == b->capacity) {
+        b->capacity = b->capacity ? b->capacity * 2 : 16;
+        b->key = (unsigned long long*)realloc(b->key, sizeof(unsigned long long) * b->capacity);
+        b->vertex = (int*)realloc(b->vertex, sizeof(int) * b->capacity);
+        if (!b->key || !b->vertex) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+    }
+    b->key[b->count] = key;
+    b->vertex[b->count++] = v;
+}
+
+void radix_push(RadixHeap* h, unsigned long long key, int v) {
+    int b = key == h->last ? 0 : highest_bit(key ^ h->last) + 1;
+    bucket_add(&h->bucket[b], key, v);
+    h->size++;
+}
+
+/* 가장 작은 키의 정점을 꺼냄 (*key 에 키 저장) */
+int radix_pop(RadixHeap* h, unsigned long long* key) {
+    RadixBucket* b0 = &h->bucket[0];
+
+    if (b0->count == 0) {
+        int i = 1;
+        while (h->bucket[i].count == 0) i++;
+
+        RadixBucket* bi = &h->bucket[i];
+        unsigned long long min = bi->key[0];
+        for (int k = 1; k < bi->count; k++)
+            if (bi->key[k] < min) min = bi->key[k];
+
+        h->last = min;
+        for (int k = 0; k < bi->count; k++) {      // 더 낮은 버킷으로 다시 나눔
+            unsigned long long x = bi->key[k];
+            int b = x == min ? 0 : highest_bit(x ^ min) + 1;
+            bucket_add(&h->bucket[b], x, bi->vertex[k]);
+        }
+        bi->count = 0;
+    }
+
+    h->size--;
+    b0->count--;
+    *key = b0->key[b0->count];
+    return b0->vertex[b0->count];
+}
+
+/*
+    ===== dijkstra_pq =====
+    - distance[v] : start 에서 v까지의 최단 거리 (도달 불가면 UNREACHABLE)
+    - pred[v]     : 최단 경로에서 v 바로 앞 정점 (start 와 도달 불가는 -1)
+                    필요 없으면 NULL
+    - kind : PQ_BINARY / PQ_QUATERNARY / PQ_RADIX
+    반환: 성공 0, 음수 가중치가 있으면 -1
+*/
+int dijkstra_pq(GraphType* g, int start, int kind, long long* distance, int* pred) {
+    short int* found = (short int*)calloc(g->n + 1, sizeof(short int));
     Node* p;
 
-    /* 초기화 */
     for (int i = 0; i < g->n; i++) {
-        distance[i] = INF;
-        found[i] = FALSE;
+        distance[i] = UNREACHABLE;
+        if (pred) pred[i] = -1;
+        for (p = g->adj_list[i]; p; p = p->link) {
+            if (p->weight < 0) {
+                fprintf(stderr, "음수 가중치 (%d -> %d, %d) : 다익스트라를 쓸 수 없음\n",
+                        i, p->vertex, p->weight);
+                free(found);
+                return -1;
+            }
+        }
+    }
+    distance[start] = 0;
+
+    if (kind == PQ_RADIX) {
+        RadixHeap h;
+        unsigned long long key;
+
+        init_radix_heap(&h);
+        radix_push(&h, 0, start);
+        while (h.size > 0) {
+            int u = radix_pop(&h, &key);
+            if (found[u] || (long long)key != distance[u]) continue;   // 낡은 항목
+            found[u] = TRUE;
+
+            for (p = g->adj_list[u]; p; p = p->link) {
+                long long nd = distance[u] + p->weight;
+                if (!found[p->vertex] && nd < distance[p->vertex]) {
+                    distance[p->vertex] = nd;
+                    if (pred) pred[p->vertex] = u;
+                    radix_push(&h, (unsigned long long)nd, p->vertex);
+                }
+            }
+        }
+        free_radix_heap(&h);
     }
+    else {
+        DaryHeap h;
+
+        init_dary_heap(&h, kind == PQ_QUATERNARY ? 4 : 2, g->n, distance);
+        dary_push_or_decrease(&h, start);
+        while (h.size > 0) {
+            int u = dary_pop(&h);
+            found[u] = TRUE;
+
+            for (p = g->adj_list[u]; p; p = p->link) {
+                long long nd = distance[u] + p->weight;
+                if (!found[p->vertex] && nd < distance[p->vertex]) {
+                    distance[p->vertex] = nd;
+                    if (pred) pred[p->vertex] = u;
+                    dary_push_or_decrease(&h, p->vertex);
+                }
+            }
+        }
+        free_dary_heap(&h);
+    }
+
+    free(found);
+    return 0;
+}
+
+/* ===== 다익스트라 (인접 리스트) : 결과 출력 ===== */
+void dijkstra(GraphType* g, int start, int kind) {
+    long long* distance = (long long*)malloc(sizeof(long long) * (g->n + 1));
+
+    if (start < 0 || start >= g->n) {
+        fprintf(stderr, "정점 번호 오류\n");
+        free(distance);
+        return;
+    }
+    if (dijkstra_pq(g, start, kind, distance, NULL) == 0) {
+        printf("Distance : ");
+        for (int i = 0; i < g->n; i++) {
+            if (distance[i] == UNREACHABLE) printf("%3d ", INF);   // 기존 출력 형식 유지
+            else printf("%3lld ", distance[i]);
+        }
+        printf("\n");
+    }
+    free(distance);
+}
 
+/*
+    ===== reference_sssp (검증용 기준 구현) =====
+    - Bellman-Ford : 모든 간선을 n - 1 번 완화 (한 번도 바뀌지 않으면 조기 종료)
+    - O(VE) 로 느리지만 큐가 없어 틀릴 곳이 적고 음수 가중치도 처리
+    반환: 성공 0, start 에서 닿는 음수 사이클이 있으면 -1
+*/
+int reference_sssp(GraphType* g, int start, long long* distance) {
+    Node* p;
+
+    for (int i = 0; i < g->n; i++) distance[i] = UNREACHABLE;
     distance[start] = 0;
 
-    for (int i = 0; i < g->n; i++) {
-        int u = choose(distance, g->n, found);
-        if (u == -1) break;
+    for (int round = 0; round < g->n; round++) {
+        int changed = FALSE;
+        for (int u = 0; u < g->n; u++) {
+            if (distance[u] == UNREACHABLE) continue;
+            for (p = g->adj_list[u]; p; p = p->link) {
+                long long nd = distance[u] + p->weight;
+                if (nd < distance[p->vertex]) {
+                    distance[p->vertex] = nd;
+                    changed = TRUE;
+                }
+            }
+        }
+        if (!changed) return 0;
+    }
+    return -1;
+}
+
+/*
+    ===== check_sssp (교차 검증) =====
+    - 세 가지 큐의 dijkstra_pq 결과를 reference_sssp 와 비교
+    - pred 가 최단 경로 트리인지 확인
+        pred[v] → v 간선 중 distance[pred[v]] + 가중치 == distance[v] 인 것이 있어야 함
+    반환: 발견한 오류 개수 (0이면 통과)
+*/
+int check_sssp(GraphType* g, int start) {
+    static const int kinds[] = { PQ_BINARY, PQ_QUATERNARY, PQ_RADIX };
+    static const char* names[] = { "binary", "4ary", "radix" };
+    long long* ref = (long long*)malloc(sizeof(long long) * (g->n + 1));
+    long long* distance = (long long*)malloc(sizeof(long long) * (g->n + 1));
+    int* pred = (int*)malloc(sizeof(int) * (g->n + 1));
+    int errors = 0;
+    Node* p;
 
-        found[u] = TRUE;
+    if (reference_sssp(g, start, ref) != 0) {
+        printf("  검증 : 음수 사이클이 있어 최단 거리가 정의되지 않음\n");
+        free(ref);
+        free(distance);
+        free(pred);
+        return 1;
+    }
 
-        /* 인접 리스트를 이용한 거리 갱신 */
-        for (p = g->adj_list[u]; p; p = p->link) {
-            if (!found[p->vertex]) {
-                if (distance[u] + p->weight < distance[p->vertex]) {
-                    distance[p->vertex] = distance[u] + p->weight;
+    for (int k = 0; k < 3; k++) {
+        if (dijkstra_pq(g, start, kinds[k], distance, pred) != 0) {
+            errors++;
+            continue;
+        }
+        for (int v = 0; v < g->n; v++) {
+            if (distance[v] != ref[v]) {
+                printf("  검증 오류 (%s) : 정점 %d 거리 %lld, 기준값 %lld\n",
+                       names[k], v, distance[v], ref[v]);
+                errors++;
+                continue;
+            }
+            if (v == start || distance[v] == UNREACHABLE) {
+                if (pred[v] != -1) {
+                    printf("  검증 오류 (%s) : 정점 %d 에 선행 정점이 있으면 안 됨\n", names[k], v);
+                    errors++;
                 }
+                continue;
+            }
+            int u = pred[v], ok = FALSE;
+            if (u >= 0 && u < g->n && distance[u] != UNREACHABLE)
+                for (p = g->adj_list[u]; p && !ok; p = p->link)
+                    ok = p->vertex == v && distance[u] + p->weight == distance[v];
+            if (!ok) {
+                printf("  검증 오류 (%s) : 정점 %d 의 선행 정점 %d 이 최단 경로가 아님\n",
+                       names[k], v, u);
+                errors++;
             }
         }
     }
 
-    /* 결과 출력 */
-    printf("Distance : ");
-    for (int i = 0; i < g->n; i++)
-        printf("%3d ", distance[i]);
-    printf("\n");
+    free(ref);
+    free(distance);
+    free(pred);
+    return errors;
+}
+
+/*
+    ===== 두 정점 사이 최단 경로 질의 (point-to-point) =====
+
+    [문제]
+    - dijkstra_pq 는 질의마다 모든 정점의 거리를 구하고 O(V) 로 초기화
+      → 한 쌍만 궁금해도 그래프 전체 비용을 냄
+
+    [질의 방식 (shortest_query 의 mode)]
+    - QUERY_DIJKSTRA      : 목표 정점이 확정되는 즉시 종료
+    - QUERY_BIDIRECTIONAL : 출발점에서 정방향, 목표에서 역방향(간선을 뒤집은 그래프)으로
+                            힙이 작은 쪽을 번갈아 확장
+                            mu = 지금까지 찾은 s → ... → t 최단 길이
+                            두 힙의 최솟값 합이 mu 이상이면 더 짧은 경로가 없으므로 종료
+    - QUERY_ASTAR         : 힙 키를 dist + h(v) 로 두어 목표 쪽으로 치우쳐 탐색
+                            h 는 바꿔 끼울 수 있음 (QueryContext.heuristic)
+                            h(v) 는 v → t 실제 거리 이하(admissible)이고
+                            h(u) <= w(u, v) + h(v) (consistent) 여야 확정 정점이 최종 거리
+
+    [기본 휴리스틱 : 랜드마크 (ALT)]
+    - 미리 고른 랜드마크 L 에서/로 가는 거리를 모든 정점에 대해 저장
+    - 삼각 부등식으로 d(v, t) >= d(L, t) - d(L, v), d(v, t) >= d(v, L) - d(t, L)
+      → 좌표가 없는 그래프에서도 쓸 수 있는 하한
+    - 랜드마크는 이미 고른 랜드마크들에서 가장 먼 정점을 차례로 선택
+
+    [질의마다 O(V) 초기화 없애기]
+    - seen[v] / done[v] 에 질의 번호(epoch)를 기록 → 값이 현재 epoch 일 때만 유효
+    - 질의가 끝나면 힙에 남은 정점의 pos 만 되돌림
+    → 질의 비용은 실제로 건드린 정점/간선 수에만 비례
+*/
+#define QUERY_DIJKSTRA      1
+#define QUERY_BIDIRECTIONAL 2
+#define QUERY_ASTAR         3
+#define QUERY_LANDMARKS     4       // 기본 랜드마크 수
+
+/* ===== 한 방향 탐색 상태 (질의마다 재사용) ===== */
+typedef struct Search {
+    long long* dist;
+    long long* key;             // 힙 키 (Dijkstra : dist, A* : dist + h)
+    int* pred;                  // 탐색 방향으로 바로 앞 정점
+    unsigned int* seen;         // seen[v] == epoch 이면 dist/pred 가 이번 질의 값
+    unsigned int* done;         // done[v] == epoch 이면 확정
+    DaryHeap heap;
+} Search;
+
+struct QueryContext;
+typedef long long (*Heuristic)(const struct QueryContext* q, int v, int target);
+
+typedef struct QueryContext {
+    CompactGraph graph[2];      // 0 : 정방향, 1 : 역방향
+    Search side[2];
+    unsigned int epoch;
+    Heuristic heuristic;        // QUERY_ASTAR 에서 사용
+    int landmarks;
+    long long* from_landmark;   // [l * n + v] : 랜드마크 l 에서 v 까지 (도달 불가 UNREACHABLE)
+    long long* to_landmark;     // [l * n + v] : v 에서 랜드마크 l 까지
+    long long settled;          // 마지막 질의에서 확정한 정점 수
+} QueryContext;
+
+void init_search(Search* s, int n) {
+    s->dist = (long long*)malloc(sizeof(long long) * (n + 1));
+    s->key = (long long*)calloc(n + 1, sizeof(long long));
+    s->pred = (int*)malloc(sizeof(int) * (n + 1));
+    s->seen = (unsigned int*)calloc(n + 1, sizeof(unsigned int));
+    s->done = (unsigned int*)calloc(n + 1, sizeof(unsigned int));
+    if (!s->dist || !s->key || !s->pred || !s->seen || !s->done) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    init_dary_heap(&s->heap, 2, n, s->key);
+}
+
+void free_search(Search* s) {
+    free(s->dist);
+    free(s->key);
+    free(s->pred);
+    free(s->seen);
+    free(s->done);
+    free_dary_heap(&s->heap);
+}
+
+/* 간선을 뒤집은 그래프 (역방향 탐색용) */
+void build_reverse(const CompactGraph* c, CompactGraph* r) {
+    int* pos;
+
+    r->n = c->n;
+    r->m = c->m;
+    r->offset = (int*)calloc(c->n + 1, sizeof(int));
+    r->adj = (int*)malloc(sizeof(int) * (c->m ? c->m : 1));
+    r->weight = (int*)malloc(sizeof(int) * (c->m ? c->m : 1));
+    pos = (int*)malloc(sizeof(int) * (c->n + 1));
+    if (!r->offset || !r->adj || !r->weight || !pos) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (int k = 0; k < c->m; k++) r->offset[c->adj[k] + 1]++;
+    for (int v = 0; v < c->n; v++) r->offset[v + 1] += r->offset[v];
+    memcpy(pos, r->offset, sizeof(int) * (c->n + 1));
+    for (int u = 0; u < c->n; u++)
+        for (int k = c->offset[u]; k < c->offset[u + 1]; k++) {
+            r->adj[pos[c->adj[k]]] = u;
+            r->weight[pos[c->adj[k]]++] = c->weight[k];
+        }
+    free(pos);
+}
+
+/* ===== 새 질의 시작 : epoch 증가 (한 바퀴 돌면 표시 배열을 0으로) ===== */
+void begin_query(QueryContext* q) {
+    if (++q->epoch == 0) {
+        for (int d = 0; d < 2; d++) {
+            memset(q->side[d].seen, 0, sizeof(unsigned int) * (q->graph[0].n + 1));
+            memset(q->side[d].done, 0, sizeof(unsigned int) * (q->graph[0].n + 1));
+        }
+        q->epoch = 1;
+    }
+    q->settled = 0;
+}
+
+/* ===== 질의 끝 : 힙에 남은 정점의 위치만 되돌림 ===== */
+void end_query(QueryContext* q) {
+    for (int d = 0; d < 2; d++) {
+        DaryHeap* h = &q->side[d].heap;
+        for (int i = 0; i < h->size; i++) h->pos[h->heap[i]] = -1;
+        h->size = 0;
+    }
+}
+
+/* side 쪽 탐색에 정점 v를 거리 dist, 앞 정점 pred 로 넣거나 줄임 */
+void search_push(QueryContext* q, int side, int v, long long dist, int pred, long long h) {
+    Search* s = &q->side[side];
+    s->seen[v] = q->epoch;
+    s->dist[v] = dist;
+    s->key[v] = dist + h;
+    s->pred[v] = pred;
+    dary_push_or_decrease(&s->heap, v);
+}
+
+/*
+    side 쪽 힙에서 정점 하나를 꺼내 확정하고 나가는 간선을 완화
+    - target >= 0 이고 A* 면 q->heuristic 으로 키를 계산
+    반환: 확정한 정점
+*/
+int settle_next(QueryContext* q, int side, int target, int astar) {
+    Search* s = &q->side[side];
+    const CompactGraph* g = &q->graph[side];
+    int u = dary_pop(&s->heap);
+
+    s->done[u] = q->epoch;
+    q->settled++;
+    for (int k = g->offset[u]; k < g->offset[u + 1]; k++) {
+        int w = g->adj[k];
+        long long nd = s->dist[u] + g->weight[k];
+        if (s->done[w] == q->epoch) continue;
+        if (s->seen[w] != q->epoch || nd < s->dist[w])
+            search_push(q, side, w, nd, u, astar ? q->heuristic(q, w, target) : 0);
+    }
+    return u;
+}
+
+/* 휴리스틱 없음 (A* 가 Dijkstra 와 같아짐) */
+long long zero_heuristic(const QueryContext* q, int v, int target) {
+    (void)q; (void)v; (void)target;
+    return 0;
+}
+
+/* 랜드마크 하한 (ALT) */
+long long landmark_heuristic(const QueryContext* q, int v, int target) {
+    int n = q->graph[0].n;
+    long long best = 0;
+
+    for (int l = 0; l < q->landmarks; l++) {
+        const long long* from = q->from_landmark + (size_t)l * n;
+        const long long* to = q->to_landmark + (size_t)l * n;
+        if (from[v] != UNREACHABLE && from[target] != UNREACHABLE && from[target] - from[v] > best)
+            best = from[target] - from[v];
+        if (to[v] != UNREACHABLE && to[target] != UNREACHABLE && to[v] - to[target] > best)
+            best = to[v] - to[target];
+    }
+    return best;
+}
+
+/* side 방향으로 start 에서 전체 탐색한 거리를 out 에 복사 (랜드마크 전처리용) */
+void full_search(QueryContext* q, int side, int start, long long* out) {
+    Search* s = &q->side[side];
+
+    begin_query(q);
+    search_push(q, side, start, 0, -1, 0);
+    while (s->heap.size > 0)
+        settle_next(q, side, -1, FALSE);
+    for (int v = 0; v < q->graph[0].n; v++)
+        out[v] = s->done[v] == q->epoch ? s->dist[v] : UNREACHABLE;
+    end_query(q);
+}
+
+/*
+    ===== select_landmarks =====
+    - 첫 랜드마크 : 정점 0 에서 가장 먼 정점
+    - 다음 랜드마크 : 이미 고른 랜드마크들로부터의 최소 거리가 가장 큰 정점
+                      (어느 랜드마크에서도 닿지 않는 정점을 우선)
+*/
+void select_landmarks(QueryContext* q, int count) {
+    int n = q->graph[0].n;
+    long long* nearest = (long long*)malloc(sizeof(long long) * (n + 1));
+    long long* scratch = (long long*)malloc(sizeof(long long) * (n + 1));
+    int next = 0;
+
+    if (count > n) count = n;
+    q->landmarks = 0;
+    q->from_landmark = (long long*)malloc(sizeof(long long) * ((size_t)count * n + 1));
+    q->to_landmark = (long long*)malloc(sizeof(long long) * ((size_t)count * n + 1));
+    if (!nearest || !scratch || !q->from_landmark || !q->to_landmark) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+
+    if (n > 0) {
+        full_search(q, 0, 0, scratch);
+        for (int v = 0; v < n; v++)
+            if (scratch[v] != UNREACHABLE && scratch[v] > scratch[next]) next = v;
+    }
+    for (int v = 0; v < n; v++) nearest[v] = LLONG_MAX;
+
+    while (q->landmarks < count) {
+        long long* from = q->from_landmark + (size_t)q->landmarks * n;
+        full_search(q, 0, next, from);
+        full_search(q, 1, next, q->to_landmark + (size_t)q->landmarks * n);
+        q->landmarks++;
+
+        next = 0;
+        for (int v = 0; v < n; v++) {
+            if (from[v] != UNREACHABLE && from[v] < nearest[v]) nearest[v] = from[v];
+            if (nearest[v] > nearest[next]) next = v;
+        }
+        if (nearest[next] == 0) break;      // 모든 정점이 이미 랜드마크
+    }
+
+    free(nearest);
+    free(scratch);
+}
+
+/*
+    ===== init_query =====
+    - 정방향/역방향 CSR, 탐색 상태, 랜드마크 (landmarks 개) 준비
+    반환: 성공 0, 음수 가중치가 있으면 -1
+*/
+int init_query(QueryContext* q, GraphType* g, int landmarks) {
+    build_compact(g, &q->graph[0]);
+    for (int k = 0; k < q->graph[0].m; k++) {
+        if (q->graph[0].weight[k] < 0) {
+            fprintf(stderr, "음수 가중치 (%d) : 최단 경로 질의를 쓸 수 없음\n", q->graph[0].weight[k]);
+            free_compact(&q->graph[0]);
+            return -1;
+        }
+    }
+    build_reverse(&q->graph[0], &q->graph[1]);
+    init_search(&q->side[0], g->n);
+    init_search(&q->side[1], g->n);
+    q->epoch = 0;
+    q->settled = 0;
+    q->from_landmark = q->to_landmark = NULL;
+    select_landmarks(q, landmarks);
+    q->heuristic = q->landmarks ? landmark_heuristic : zero_heuristic;
+    return 0;
+}
+
+void free_query(QueryContext* q) {
+    for (int d = 0; d < 2; d++) {
+        free_compact(&q->graph[d]);
+        free_search(&q->side[d]);
+    }
+    free(q->from_landmark);
+    free(q->to_landmark);
+}
+
+/* pred 를 따라 side 방향 탐색의 출발점까지 (from 포함) 정점 수 */
+int chain_length(const Search* s, int from, int origin) {
+    int count = 1;
+    for (int v = from; v != origin; v = s->pred[v]) count++;
+    return count;
+}
+
+/*
+    ===== shortest_query =====
+    - start → target 최단 거리 (도달 불가면 UNREACHABLE)
+    - path 가 NULL 이 아니면 start, ..., target 순서로 채우고 *count 에 정점 수
+      (path 는 정점 수 칸이면 충분)
+    - q->settled : 확정한 정점 수 (질의 비용)
+*/
+long long shortest_query(QueryContext* q, int start, int target, int mode, int* path, int* count) {
+    Search* f = &q->side[0];
+    Search* b = &q->side[1];
+    long long result = UNREACHABLE;
+    int meet_f = -1, meet_b = -1;       // 경로 = start ~ meet_f → meet_b ~ target
+
+    begin_query(q);
+    if (count) *count = 0;
+
+    if (mode == QUERY_BIDIRECTIONAL) {
+        long long mu = LLONG_MAX;
+
+        search_push(q, 0, start, 0, -1, 0);
+        search_push(q, 1, target, 0, -1, 0);
+        if (start == target) {
+            mu = 0;
+            meet_f = meet_b = start;
+        }
+        while (f->heap.size > 0 && b->heap.size > 0) {
+            if (mu != LLONG_MAX &&
+                f->key[f->heap.heap[0]] + b->key[b->heap.heap[0]] >= mu)
+                break;
+
+            int side = f->heap.size <= b->heap.size ? 0 : 1;
+            Search* s = &q->side[side];
+            Search* o = &q->side[1 - side];
+            const CompactGraph* g = &q->graph[side];
+            int u = settle_next(q, side, -1, FALSE);
+
+            // u 에서 나가는 간선이 반대쪽 탐색이 본 정점에 닿으면 경로 후보
+            for (int k = g->offset[u]; k < g->offset[u + 1]; k++) {
+                int w = g->adj[k];
+                if (o->seen[w] != q->epoch) continue;
+                long long cand = s->dist[u] + g->weight[k] + o->dist[w];
+                if (cand < mu) {
+                    mu = cand;
+                    meet_f = side == 0 ? u : w;
+                    meet_b = side == 0 ? w : u;
+                }
+            }
+        }
+        if (mu != LLONG_MAX) result = mu;
+    }
+    else {
+        int astar = mode == QUERY_ASTAR;
+
+        search_push(q, 0, start, 0, -1, astar ? q->heuristic(q, start, target) : 0);
+        while (f->heap.size > 0)
+            if (settle_next(q, 0, target, astar) == target) break;
+        if (f->done[target] == q->epoch) {
+            result = f->dist[target];
+            meet_f = meet_b = target;
+        }
+    }
+
+    if (path && result != UNREACHABLE) {
+        int n_f = chain_length(f, meet_f, start);
+        int i = n_f;
+        for (int v = meet_f; ; v = f->pred[v]) {     // start ~ meet_f 를 뒤에서부터
+            path[--i] = v;
+            if (v == start) break;
+        }
+        i = n_f;
+        if (meet_b != meet_f)
+            for (int v = meet_b; ; v = b->pred[v]) {   // meet_b ~ target (역방향 pred 는 target 쪽)
+                path[i++] = v;
+                if (v == target) break;
+            }
+        *count = i;
+    }
+
+    end_query(q);
+    return result;
 }
 
 /* ===== 메모리 해제 ===== */
@@ -121,12 +997,29 @@ void free_graph(GraphType* g) {
         }
         g->adj_list[i] = NULL;
     }
+    free(g->adj_list);
+    init(g);
 }
 
-/* ===== main ===== */
-int main(void) {
+/*
+    ===== main =====
+    - 실행 인자로 우선순위 큐 선택 : binary (기본), 4ary, radix
+    - 실행 인자 check : 시작 정점마다 세 큐 모두를 기준 구현과 교차 검증
+*/
+int main(int argc, char** argv) {
     GraphType g;
     int n, from, to, w, start;
+    int kind = PQ_BINARY, check = FALSE;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "4ary") == 0) kind = PQ_QUATERNARY;
+        else if (strcmp(argv[i], "radix") == 0) kind = PQ_RADIX;
+        else if (strcmp(argv[i], "check") == 0) check = TRUE;
+        else if (strcmp(argv[i], "binary") != 0) {
+            fprintf(stderr, "사용법: %s [binary | 4ary | radix] [check]\n", argv[0]);
+            return 1;
+        }
+    }
 
     init(&g);
 
@@ -146,6 +1039,7 @@ int main(void) {
     }
 
     print_graph(&g);
+    print_scc(&g);
 
     printf("\n11.2. 최단 경로 (단일 출발점, Dijkstra)\n");
     while (1) {
@@ -153,7 +1047,54 @@ int main(void) {
         scanf("%d", &start);
         if (start == -1)
             break;
-        dijkstra(&g, start);
+        dijkstra(&g, start, kind);
+        if (check && start >= 0 && start < g.n) {
+            int errors = check_sssp(&g, start);
+            printf(errors ? "  검증 : 오류 %d개\n" : "  검증 : 통과\n", errors);
+        }
+    }
+
+    printf("\n11.3. 두 정점 사이 최단 경로 (조기 종료 / 양방향 / A*)\n");
+    QueryContext q;
+    if (init_query(&q, &g, QUERY_LANDMARKS) == 0) {
+        static const int modes[] = { QUERY_DIJKSTRA, QUERY_BIDIRECTIONAL, QUERY_ASTAR };
+        static const char* names[] = { "Dijkstra (조기 종료)", "양방향 Dijkstra", "A* (랜드마크)" };
+        int* path = (int*)malloc(sizeof(int) * (g.n + 1));
+        long long* full = (long long*)malloc(sizeof(long long) * (g.n + 1));
+        int count;
+
+        while (1) {
+            printf("경로 (from to) : ");
+            if (scanf("%d %d", &from, &to) != 2 || from == -1)
+                break;
+            if (from < 0 || to < 0 || from >= g.n || to >= g.n) {
+                fprintf(stderr, "정점 번호 오류\n");
+                continue;
+            }
+
+            long long result[3];
+            for (int m = 0; m < 3; m++) {
+                result[m] = shortest_query(&q, from, to, modes[m], path, &count);
+                if (result[m] == UNREACHABLE) printf("\n  %s : 경로 없음", names[m]);
+                else printf("\n  %s : 거리 %lld, 확정 정점 %lld개", names[m], result[m], q.settled);
+            }
+            printf("\n");
+            if (result[2] != UNREACHABLE) {
+                printf("  경로 :");
+                for (int i = 0; i < count; i++) printf(i ? " -> %d" : " %d", path[i]);
+                printf("\n");
+            }
+
+            if (check) {
+                dijkstra_pq(&g, from, kind, full, NULL);
+                int same = result[0] == full[to] && result[1] == full[to] && result[2] == full[to];
+                printf(same ? "  검증 : 통과\n" : "  검증 : 전체 Dijkstra 와 다름\n");
+            }
+        }
+
+        free(path);
+        free(full);
+        free_query(&q);
     }
 
     free_graph(&g);
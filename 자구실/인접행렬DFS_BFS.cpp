@@ -1,60 +1,97 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-#define MAX_VERTICES 100
 #define FALSE 0
 #define TRUE 1
 
-/* ===== 전역 변수 ===== */
-int graph[MAX_VERTICES][MAX_VERTICES];   // 인접 행렬
-short int visited[MAX_VERTICES];
+/* ===== 전역 변수 =====
+   인접 행렬은 capacity x capacity 크기로 실행 중에 할당
+   (graph[i]는 한 덩어리 메모리 안의 i번째 행을 가리킴) */
+int** graph = NULL;         // 인접 행렬
+short int* visited = NULL;
 int n;
-
-/* ===== 큐 구조체 (BFS용) ===== */
-typedef struct queue {
-    int vertex;
-    struct queue* link;
-} Queue;
+int capacity = 0;
+
+/*
+    ===== BFS용 배열 큐 =====
+    - 정점 수(capacity) 크기로 미리 할당해 두고 grow_graph 에서 함께 확장
+    - 한 번의 BFS 에서 각 정점은 최대 한 번만 들어가므로
+      front / rear 인덱스만 앞으로 움직이면 넘칠 일이 없음
+    - 예전처럼 정점마다 큐 노드를 calloc / free 하지 않음
+*/
+int* queue = NULL;
+
+/* ===== 그래프 확장 =====
+   정점 v까지 담을 수 있도록 행렬을 2배씩 늘리고 기존 값 복사 */
+void grow_graph(int v) {
+    int i, new_capacity;
+    int* block;
+    int** rows;
+
+    if (v >= n) n = v + 1;
+    if (v < capacity) return;
+
+    new_capacity = capacity ? capacity : 16;
+    while (new_capacity <= v) new_capacity *= 2;
+
+    block = (int*)calloc((size_t)new_capacity * new_capacity, sizeof(int));
+    rows = (int**)malloc(sizeof(int*) * new_capacity);
+    visited = (short int*)realloc(visited, sizeof(short int) * new_capacity);
+    queue = (int*)realloc(queue, sizeof(int) * new_capacity);
+    if (!block || !rows || !visited || !queue) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    for (i = 0; i < new_capacity; i++) {
+        rows[i] = block + (size_t)i * new_capacity;
+        if (i < capacity)
+            memcpy(rows[i], graph[i], sizeof(int) * capacity);
+        else
+            visited[i] = FALSE;
+    }
+    if (graph) {
+        free(graph[0]);
+        free(graph);
+    }
+    graph = rows;
+    capacity = new_capacity;
+}
 
 /* ===== 그래프 초기화 ===== */
 void init_graph(int n) {
-    int i, j;
-    for (i = 0; i < n; i++)
-        for (j = 0; j < n; j++)
-            graph[i][j] = 0;
+    if (n > 0) grow_graph(n - 1);
+}
+
+/* ===== 그래프 메모리 해제 ===== */
+void free_graph(void) {
+    if (graph) {
+        free(graph[0]);
+        free(graph);
+    }
+    free(visited);
+    free(queue);
+    graph = NULL;
+    visited = NULL;
+    queue = NULL;
+    n = capacity = 0;
 }
 
 /* ===== 간선 삽입 (무방향 그래프) ===== */
 void insert_edge(int u, int v) {
+    grow_graph(u > v ? u : v);
     graph[u][v] = 1;
     graph[v][u] = 1;
 }
 
-/* ===== 큐 연산 ===== */
-void addq(Queue** front, Queue** rear, int v) {
-    Queue* temp = (Queue*)calloc(1, sizeof(Queue));
-    temp->vertex = v;
-    temp->link = NULL;
-
-    if (*rear)
-        (*rear)->link = temp;
-    else
-        *front = temp;
-
-    *rear = temp;
+/* ===== 큐 연산 (배열 인덱스만 이동, O(1)) ===== */
+void addq(int* rear, int v) {
+    queue[(*rear)++] = v;
 }
 
-int deleteq(Queue** front, Queue** rear) {
-    Queue* temp = *front;
-    int v = temp->vertex;
-
-    *front = temp->link;
-    if (*front == NULL)
-        *rear = NULL;
-
-    free(temp);
-    return v;
+int deleteq(int* front) {
+    return queue[(*front)++];
 }
 
 /* ===== 그래프 출력 및 degree 계산 ===== */
@@ -106,19 +143,19 @@ void dfs(int v) {
 /* ===== BFS ===== */
 void bfs(int v) {
     int w;
-    Queue* front = NULL, * rear = NULL;
+    int front = 0, rear = 0;
 
     visited[v] = TRUE;
     printf("%5d", v);
-    addq(&front, &rear, v);
+    addq(&rear, v);
 
-    while (front) {
-        v = deleteq(&front, &rear);
+    while (front < rear) {
+        v = deleteq(&front);
         for (w = 0; w < n; w++) {
             if (graph[v][w] && !visited[w]) {
                 visited[w] = TRUE;
                 printf("%5d", w);
-                addq(&front, &rear, w);
+                addq(&rear, w);
             }
         }
     }
@@ -140,18 +177,18 @@ void dfs_spanning(int v) {
 /* ===== BFS 신장트리 ===== */
 void bfs_spanning(int start) {
     int v, w;
-    Queue* front = NULL, * rear = NULL;
+    int front = 0, rear = 0;
 
     visited[start] = TRUE;
-    addq(&front, &rear, start);
+    addq(&rear, start);
 
-    while (front) {
-        v = deleteq(&front, &rear);
+    while (front < rear) {
+        v = deleteq(&front);
         for (w = 0; w < n; w++) {
             if (graph[v][w] && !visited[w]) {
                 visited[w] = TRUE;
                 printf("  (%d, %d)", v, w);   // 신장트리 간선
-                addq(&front, &rear, w);
+                addq(&rear, w);
             }
         }
     }
@@ -163,7 +200,7 @@ int main(void) {
 
     printf("10.1. 인접 행렬 형태의 무방향성 그래프 생성\n");
     printf("  노드 개수(n): ");
-    if (scanf("%d", &n) != 1)
+    if (scanf("%d", &n) != 1 || n <= 0)
         return 0;
 
     init_graph(n);
@@ -174,6 +211,8 @@ int main(void) {
             return 0;
         if (u == -1 && v == -1)
             break;
+        if (u < 0 || v < 0)
+            continue;
         insert_edge(u, v);
     }
 
@@ -218,5 +257,6 @@ int main(void) {
         printf("\n");
     }
 
+    free_graph();
     return 0;
 }
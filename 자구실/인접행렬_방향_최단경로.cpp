@@ -1,25 +1,81 @@
 #define _CRT_SECURE_NO_WARNINGS
 #include <stdio.h>
 #include <stdlib.h>
-#define MAX_VERTICES 100
 #define FALSE 0
 #define TRUE 1
 #define INT_MAX 99999
 
 typedef struct GraphType {
-    int n;
-    int adj_mat[MAX_VERTICES][MAX_VERTICES];
+    int n;          // 정점 개수
+    int capacity;   // adj_mat 에 할당된 행(열) 수
+    int** adj_mat;  // 인접 행렬 (capacity x capacity, 처음 정점이 들어올 때 할당)
 } GraphType;
 
 void init(GraphType* g) {
-    int r, c;
     g->n = 0;
-    for (r = 0; r < MAX_VERTICES; r++)
-        for (c = 0; c < MAX_VERTICES; c++){
-            if (r == c) g->adj_mat[r][c] = 0;
-            else g->adj_mat[r][c] = INT_MAX;
+    g->capacity = 0;
+    g->adj_mat = NULL;
+}
+
+/*
+    ===== alloc_matrix / free_matrix =====
+    - rows x rows 정수 행렬을 한 덩어리로 할당하고 행 포인터 배열을 붙임
+      → m[i][j] 문법 그대로 사용 가능
+*/
+int** alloc_matrix(int rows) {
+    size_t cells = (size_t)rows * rows;
+    int** m = (int**)malloc(sizeof(int*) * (rows > 0 ? rows : 1));
+    int* block = (int*)malloc(sizeof(int) * (cells > 0 ? cells : 1));
+    if (!m || !block) {
+        fprintf(stderr, "메모리 할당 오류\n");
+        exit(1);
+    }
+    m[0] = block;   // rows == 0 이어도 free_matrix 가 block을 해제할 수 있도록
+    for (int i = 1; i < rows; i++)
+        m[i] = block + (size_t)i * rows;
+    return m;
+}
+
+void free_matrix(int** m) {
+    if (m) {
+        free(m[0]);
+        free(m);
+    }
+}
+
+/*
+    ===== grow =====
+    - 행렬을 최소 need 행까지 2배씩 늘리고 기존 값 복사
+    - 새로 생긴 칸: 자기 자신으로 가는 비용은 0, 나머지는 INT_MAX
+*/
+void grow(GraphType* g, int need) {
+    int r, c, new_capacity;
+    int** m;
+
+    if (need <= g->capacity) return;
+
+    new_capacity = g->capacity ? g->capacity : 16;
+    while (new_capacity < need) new_capacity *= 2;
+
+    m = alloc_matrix(new_capacity);
+    for (r = 0; r < new_capacity; r++)
+        for (c = 0; c < new_capacity; c++) {
+            if (r < g->capacity && c < g->capacity)
+                m[r][c] = g->adj_mat[r][c];
+            else if (r == c)
+                m[r][c] = 0;
+            else
+                m[r][c] = INT_MAX;
         }
 
+    free_matrix(g->adj_mat);
+    g->adj_mat = m;
+    g->capacity = new_capacity;
+}
+
+void free_graph(GraphType* g) {
+    free_matrix(g->adj_mat);
+    init(g);
 }
 int choose(int distance[], int n, short int found[])
 {
@@ -50,7 +106,7 @@ void print_adj_mat(GraphType* g) {
     }
 }
 
-void shortestPath(int v, int cost[][MAX_VERTICES], int distance[], int n, short int found[])
+void shortestPath(int v, int** cost, int distance[], int n, short int found[])
 {
     int i, u, w;
 
@@ -64,6 +120,7 @@ void shortestPath(int v, int cost[][MAX_VERTICES], int distance[], int n, short
 
     for (i = 0; i < n - 2; i++) {
         u = choose(distance, n, found);
+        if (u == -1) break;   // 남은 정점은 도달 불가
         found[u] = TRUE;
         for (w = 0; w < n; w++)
             if (!found[w])
@@ -74,8 +131,7 @@ void shortestPath(int v, int cost[][MAX_VERTICES], int distance[], int n, short
 
 
 
-void allCosts(int cost[][MAX_VERTICES],
-    int distance[][MAX_VERTICES], int n)
+void allCosts(int** cost, int** distance, int n)
 {
     int i, j, k;
 
@@ -91,15 +147,13 @@ void allCosts(int cost[][MAX_VERTICES],
 }
 
 void insert_vertex(GraphType* g, int v) {
-    if (((g->n) + 1) > MAX_VERTICES) {
-        fprintf(stderr, "overflow");
-        return;
-    }
+    (void)v;            // 정점 번호는 항상 g->n (순서대로 추가)
+    grow(g, g->n + 1);  // 행렬이 꽉 찼으면 확장
     g->n++;
 }
 
 void insert_edge(GraphType* g, int from, int to, int w) {
-    if (from >= g->n || to >= g->n) {
+    if (from < 0 || to < 0 || from >= g->n || to >= g->n) {
         fprintf(stderr, "vertex key error");
         return;
     }
@@ -131,8 +185,8 @@ int main() {
     // 2
     printf("\n﻿11.2. 최단 경로 (단일 출발점)\n");
 
-    int distance[MAX_VERTICES];
-    short int found[MAX_VERTICES];
+    int* distance = (int*)malloc(sizeof(int) * (g->n + 1));
+    short int* found = (short int*)malloc(sizeof(short int) * (g->n + 1));
 
     while (1) {
         printf("\n시작 노드 (v) : ");
@@ -153,7 +207,7 @@ int main() {
 
     // 3
     printf("﻿\n11.3. 최단 경로 (모든 경로)\nAll Path Distance :\n");
-    int allDist[MAX_VERTICES][MAX_VERTICES];
+    int** allDist = alloc_matrix(g->n);
     allCosts(g->adj_mat, allDist, g->n);
 
 
@@ -173,4 +227,10 @@ int main() {
         printf("\n");
     }
 
+    free_matrix(allDist);
+    free(distance);
+    free(found);
+    free_graph(g);
+    free(g);
+    return 0;
 }
\ No newline at end of file
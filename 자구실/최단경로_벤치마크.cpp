@@ -0,0 +1,1002 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+    ===== 최단 경로 벤치마크 (합성 그래프 생성 + 모든 구현 측정, CSV 출력) =====
+
+    [왜 필요한가]
+    - 지금까지의 최단 경로 프로그램은 모두 scanf 로 그래프를 받거나 (책 예제처럼)
+      7정점 행렬이 박혀 있어 큰 그래프에서 구현끼리 비교할 방법이 없었음
+
+    [구성]
+    - 각 프로그램의 .cpp 를 이름공간(namespace) 안에 그대로 #include 하고
+      main 은 program_main 으로 이름을 바꿔 둠 → 원본 코드를 고치지 않고 함수만 호출
+    - 파일마다 FALSE, UNREACHABLE 같은 매크로 뜻이 달라서
+      포함한 직후 그 파일 매크로를 쓰는 어댑터를 만들고 매크로를 지움
+    - 거리는 모두 long long, 도달 불가는 NO_PATH 로 맞춰 비교
+
+    [그래프 생성기 (seed 가 같으면 항상 같은 그래프)]
+    - er       : Erdős–Rényi, 임의의 (u, v) 를 n x degree 번 뽑음
+    - rmat     : R-MAT / Kronecker (a, b, c, d = 0.57, 0.19, 0.19, 0.05, Graph500 과 같은 값)
+    - grid     : 2차원 격자, 상하좌우 이웃으로 양방향 간선 (방향마다 가중치 따로)
+    - powerlaw : Chung-Lu, 정점 i 의 기대 차수가 (i + 1)^(-1 / (gamma - 1)) 에 비례 (gamma = 2.5)
+    - rmat / powerlaw 는 정점 번호를 섞어 허브가 앞 번호에 몰리지 않게 함
+    - 자기 루프와 중복 간선은 지움 (같은 간선은 가장 짧은 것만) → 행렬 구현과 결과가 같도록
+    - 가중치는 [1, weight] 균등 분포
+
+    [측정하는 구현]
+        이름                    원본                               종류
+        matrix_dijkstra         실습과제_주석/11장.cpp shortestPath   단일 출발점, O(V^2)
+        matrix_dijkstra_legacy  인접행렬_방향_최단경로.cpp           단일 출발점 (무한대 99999)
+        list_dijkstra_binary    인접리스트_방향_최단경로.cpp         단일 출발점, 이진 힙
+        list_dijkstra_4ary      〃                                   4진 힙
+        list_dijkstra_radix     〃                                   기수 힙
+        csr_dijkstra            델타스테핑_최단경로.cpp dijkstra_serial
+        delta_stepping          델타스테핑_최단경로.cpp              스레드 수별
+        bellman_ford            존슨_최단경로.cpp                    스레드 수별
+        list_early_exit         인접리스트_방향_최단경로.cpp         두 점 질의 (목표에서 멈춤)
+        list_bidirectional      〃                                   두 점 질의, 양방향
+        list_astar              〃                                   두 점 질의, A* + 랜드마크
+        contraction_hierarchy   축약계층_최단경로.cpp                두 점 질의 (격자만)
+        floyd_blocked           실습과제_주석/11장.cpp allCosts      모든 쌍, 스레드 수별
+        floyd_reference         실습과제_주석/11장.cpp 기본형        모든 쌍
+        floyd_legacy            인접행렬_방향_최단경로.cpp allCosts  모든 쌍
+        johnson                 존슨_최단경로.cpp                    모든 쌍, 스레드 수별
+    - 책 예제/그래프2 의 dijkstra.c / floyd.c 는 단계마다 표를 출력하고
+      dijkstra.c 는 100 x 100 고정 배열이라 빼고, 같은 알고리즘인 위 행렬 구현으로 대신함
+    - matrix_dijkstra_legacy / floyd_legacy 는 99999 이상을 도달 불가로 보므로
+      weight 를 크게 주어 경로 길이가 99999 를 넘으면 correct 가 0 이 됨 (원본의 한계 그대로)
+    - 축약 계층은 계층이 없는 무작위 그래프에서 전처리가 매우 느려 (축약계층_최단경로.cpp 의 [한계])
+      격자에서만 잼
+
+    [CSV 열]
+    - graph, n, m           : 생성기 이름, 정점 수, 간선 수 (중복 제거 후)
+    - algorithm, kind       : 구현 이름, sssp / p2p / apsp
+    - threads, runs         : 스레드 수, 잰 횟수 (출발점 수, 질의 수, 모든 쌍은 1)
+    - build_seconds         : 구현 자신의 그래프 표현 (행렬, 연결 리스트, CSR, 색인) 을 만든 시간
+    - seconds               : 실행 한 번 평균 시간
+    - edges_per_sec         : sssp / p2p 는 m / seconds, apsp 는 n x m / seconds
+    - memory_bytes          : 표현을 만들고 실행하는 동안의 최대 힙 사용량 (malloc, new 모두 셈)
+    - correct               : 같은 출발점의 기준 다익스트라 결과와 모두 같으면 1
+    - 크기 (sizes) 와 스레드 (threads) 를 여러 개 주면 행들이 곧 규모 / 스레드 확장 곡선
+
+    [실행]
+    - 인자는 모두 "이름=값", 생략하면 기본값
+        graphs=er,rmat,grid,powerlaw  sizes=1024,4096,16384  degree=8  weight=100  seed=1
+        threads=1,2,4,...(코어 수까지)  sources=4  queries=100
+        matrix=4096 (행렬 구현 최대 정점 수)  apsp=2048 (모든 쌍)  cubic=1024 (O(V^3) 기본형)
+        ch=65536 (축약 계층)  only=이름,이름 (일부 구현만)  out=파일 (기본은 표준 출력)
+    - 진행 상황은 표준 오류로 출력
+*/
+
+/*
+    ===== 힙 사용량 측정 =====
+    - 블록 앞 HEAP_HEADER 바이트에 크기를 적어 두고 살아 있는 바이트 수와 최댓값을 셈
+    - 포함하는 원본 코드의 malloc / calloc / realloc / free 는 아래 매크로로,
+      std::vector 와 new 는 전역 operator new / delete 교체로 같은 함수를 거침
+*/
+#define HEAP_HEADER 16          // 크기 기록 칸 (malloc 정렬 단위를 유지)
+
+std::atomic<long long> heap_live(0);
+std::atomic<long long> heap_peak(0);
+
+void heap_add(long long bytes) {
+    long long now = heap_live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    long long peak = heap_peak.load(std::memory_order_relaxed);
+    while (now > peak && !heap_peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+}
+
+void* bench_malloc(size_t size) {
+    unsigned char* block = (unsigned char*)malloc(size + HEAP_HEADER);
+    if (!block) return NULL;
+    *(size_t*)block = size;
+    heap_add((long long)size);
+    return block + HEAP_HEADER;
+}
+
+void bench_free(void* p) {
+    if (!p) return;
+    unsigned char* block = (unsigned char*)p - HEAP_HEADER;
+    heap_add(-(long long)*(size_t*)block);
+    free(block);
+}
+
+void* bench_calloc(size_t count, size_t size) {
+    void* p = bench_malloc(count * size);
+    if (p) memset(p, 0, count * size);
+    return p;
+}
+
+void* bench_realloc(void* p, size_t size) {
+    if (!p) return bench_malloc(size);
+    unsigned char* block = (unsigned char*)p - HEAP_HEADER;
+    size_t old = *(size_t*)block;
+    block = (unsigned char*)realloc(block, size + HEAP_HEADER);
+    if (!block) return NULL;
+    *(size_t*)block = size;
+    heap_add((long long)size - (long long)old);
+    return block + HEAP_HEADER;
+}
+
+void* operator new(size_t size) {
+    void* p = bench_malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { bench_free(p); }
+void operator delete[](void* p) noexcept { bench_free(p); }
+void operator delete(void* p, size_t) noexcept { bench_free(p); }
+void operator delete[](void* p, size_t) noexcept { bench_free(p); }
+
+/* ===== 생성한 그래프 (간선 목록) ===== */
+typedef struct BenchGraph {
+    const char* kind;                   // er / rmat / grid / powerlaw
+    int n;
+    std::vector<int> from, to, weight;
+} BenchGraph;
+
+#define NO_PATH LLONG_MAX               // 도달할 수 없는 정점의 거리 (모든 구현 공통 표기)
+
+/*
+    ===== 원본 프로그램 포함 =====
+    - 이름공간마다 prepare (표현 구성) / run (한 번 실행) / result (거리 한 행 꺼내기) /
+      release (해제) 어댑터를 둠
+*/
+#define malloc(size) bench_malloc(size)
+#define calloc(count, size) bench_calloc(count, size)
+#define realloc(p, size) bench_realloc(p, size)
+#define free(p) bench_free(p)
+#define main program_main
+
+/* ----- 실습과제_주석/11장.cpp : 행렬 다익스트라, 타일 분할 / 기본형 Floyd-Warshall ----- */
+namespace matrix11 {
+#include "../실습과제_주석/11장.cpp"
+
+typedef struct State {
+    GraphType g;
+    long long* distance;
+    short int* found;
+    int** all;                      // 모든 쌍 결과 (처음 쓸 때 할당)
+} State;
+
+void* prepare(const BenchGraph* bg) {
+    State* s = (State*)malloc(sizeof(State));
+    init(&s->g);
+    for (int v = 0; v < bg->n; v++) insert_vertex(&s->g, v);
+    for (size_t e = 0; e < bg->from.size(); e++) insert_edge(&s->g, bg->from[e], bg->to[e], bg->weight[e]);
+    s->distance = (long long*)malloc(sizeof(long long) * (bg->n + 1));
+    s->found = (short int*)malloc(sizeof(short int) * (bg->n + 1));
+    s->all = NULL;
+    return s;
+}
+
+long long run_sssp(void* p, int source, int, int) {
+    State* s = (State*)p;
+    shortestPath(source, s->g.adj_mat, s->distance, s->g.n, s->found, NULL);
+    return 0;
+}
+
+void result_sssp(void* p, int, long long* out) {
+    State* s = (State*)p;
+    memcpy(out, s->distance, sizeof(long long) * s->g.n);     // UNREACHABLE == NO_PATH
+}
+
+long long run_blocked(void* p, int, int, int threads) {
+    State* s = (State*)p;
+    if (!s->all) s->all = alloc_matrix(s->g.n);
+    allCosts(s->g.adj_mat, s->all, s->g.n, threads, NULL);
+    return 0;
+}
+
+long long run_reference(void* p, int, int, int) {
+    State* s = (State*)p;
+    if (!s->all) s->all = alloc_matrix(s->g.n);
+    all_costs_reference(s->g.adj_mat, s->all, s->g.n, NULL);
+    return 0;
+}
+
+void result_all(void* p, int source, long long* out) {
+    State* s = (State*)p;
+    for (int v = 0; v < s->g.n; v++) out[v] = s->all[source][v] == NO_EDGE ? NO_PATH : s->all[source][v];
+}
+
+void release(void* p) {
+    State* s = (State*)p;
+    free_graph(&s->g);
+    free(s->distance);
+    free(s->found);
+    free_matrix(s->all);
+    free(s);
+}
+}
+#undef FALSE
+#undef TRUE
+#undef NO_EDGE
+#undef UNREACHABLE
+#undef HOP16_LIMIT
+#undef FW_BLOCK
+#undef FW_UNREACHABLE
+#undef FW_REACH_LIMIT
+
+/* ----- 인접행렬_방향_최단경로.cpp : 무한대를 INT_MAX = 99999 로 다시 정의한 원래 구현 ----- */
+#pragma push_macro("INT_MAX")
+#undef INT_MAX
+namespace legacy {
+#include "인접행렬_방향_최단경로.cpp"
+
+typedef struct State {
+    GraphType g;
+    int* distance;
+    short int* found;
+    int** all;
+} State;
+
+void* prepare(const BenchGraph* bg) {
+    State* s = (State*)malloc(sizeof(State));
+    init(&s->g);
+    for (int v = 0; v < bg->n; v++) insert_vertex(&s->g, v);
+    for (size_t e = 0; e < bg->from.size(); e++) insert_edge(&s->g, bg->from[e], bg->to[e], bg->weight[e]);
+    s->distance = (int*)malloc(sizeof(int) * (bg->n + 1));
+    s->found = (short int*)malloc(sizeof(short int) * (bg->n + 1));
+    s->all = NULL;
+    return s;
+}
+
+long long run_sssp(void* p, int source, int, int) {
+    State* s = (State*)p;
+    shortestPath(source, s->g.adj_mat, s->distance, s->g.n, s->found);
+    return 0;
+}
+
+void result_sssp(void* p, int, long long* out) {
+    State* s = (State*)p;
+    for (int v = 0; v < s->g.n; v++) out[v] = s->distance[v] >= INT_MAX ? NO_PATH : s->distance[v];
+}
+
+long long run_all(void* p, int, int, int) {
+    State* s = (State*)p;
+    if (!s->all) s->all = alloc_matrix(s->g.n);
+    allCosts(s->g.adj_mat, s->all, s->g.n);
+    return 0;
+}
+
+void result_all(void* p, int source, long long* out) {
+    State* s = (State*)p;
+    for (int v = 0; v < s->g.n; v++) out[v] = s->all[source][v] >= INT_MAX ? NO_PATH : s->all[source][v];
+}
+
+void release(void* p) {
+    State* s = (State*)p;
+    free_graph(&s->g);
+    free(s->distance);
+    free(s->found);
+    free_matrix(s->all);
+    free(s);
+}
+}
+#undef FALSE
+#undef TRUE
+#undef INT_MAX
+#pragma pop_macro("INT_MAX")
+
+/* ----- 인접리스트_방향_최단경로.cpp : 힙 세 가지, 두 점 질의 세 가지 ----- */
+namespace list {
+#include "인접리스트_방향_최단경로.cpp"
+
+typedef struct State {
+    GraphType g;
+    long long* distance;
+    QueryContext q;
+    int has_query;
+} State;
+
+State* build(const BenchGraph* bg) {
+    State* s = (State*)malloc(sizeof(State));
+    init(&s->g);
+    for (int v = 0; v < bg->n; v++) insert_vertex(&s->g, v);
+    for (size_t e = 0; e < bg->from.size(); e++) insert_edge(&s->g, bg->from[e], bg->to[e], bg->weight[e]);
+    s->distance = (long long*)malloc(sizeof(long long) * (bg->n + 1));
+    s->has_query = FALSE;
+    return s;
+}
+
+void* prepare(const BenchGraph* bg) { return build(bg); }
+
+/* 두 점 질의용 : 정방향/역방향 CSR 과 랜드마크까지 만듦 */
+void* prepare_query(const BenchGraph* bg) {
+    State* s = build(bg);
+    s->has_query = init_query(&s->q, &s->g, QUERY_LANDMARKS) == 0;
+    return s;
+}
+
+long long run_binary(void* p, int source, int, int) {
+    State* s = (State*)p;
+    return dijkstra_pq(&s->g, source, PQ_BINARY, s->distance, NULL);
+}
+
+long long run_quaternary(void* p, int source, int, int) {
+    State* s = (State*)p;
+    return dijkstra_pq(&s->g, source, PQ_QUATERNARY, s->distance, NULL);
+}
+
+long long run_radix(void* p, int source, int, int) {
+    State* s = (State*)p;
+    return dijkstra_pq(&s->g, source, PQ_RADIX, s->distance, NULL);
+}
+
+void result(void* p, int, long long* out) {
+    State* s = (State*)p;
+    memcpy(out, s->distance, sizeof(long long) * s->g.n);     // UNREACHABLE == NO_PATH
+}
+
+long long query(State* s, int source, int target, int mode) {
+    return shortest_query(&s->q, source, target, mode, NULL, NULL);
+}
+
+long long run_early_exit(void* p, int source, int target, int) {
+    return query((State*)p, source, target, QUERY_DIJKSTRA);
+}
+
+long long run_bidirectional(void* p, int source, int target, int) {
+    return query((State*)p, source, target, QUERY_BIDIRECTIONAL);
+}
+
+long long run_astar(void* p, int source, int target, int) {
+    return query((State*)p, source, target, QUERY_ASTAR);
+}
+
+void release(void* p) {
+    State* s = (State*)p;
+    if (s->has_query) free_query(&s->q);
+    free_graph(&s->g);
+    free(s->distance);
+    free(s);
+}
+}
+#undef INF
+#undef FALSE
+#undef TRUE
+#undef PQ_BINARY
+#undef PQ_QUATERNARY
+#undef PQ_RADIX
+#undef UNREACHABLE
+#undef RADIX_BUCKETS
+#undef QUERY_DIJKSTRA
+#undef QUERY_BIDIRECTIONAL
+#undef QUERY_ASTAR
+#undef QUERY_LANDMARKS
+
+/* ----- 델타스테핑_최단경로.cpp : 델타 스테핑, CSR 이진 힙 다익스트라 ----- */
+namespace delta {
+#include "델타스테핑_최단경로.cpp"
+
+typedef struct State {
+    WeightedGraph g;
+    long long delta;
+    long long* distance;
+} State;
+
+void* prepare(const BenchGraph* bg) {
+    State* s = (State*)malloc(sizeof(State));
+    EdgeList el;
+    memset(&el, 0, sizeof(el));
+    for (size_t e = 0; e < bg->from.size(); e++) add_edge(&el, bg->from[e], bg->to[e], bg->weight[e]);
+    build_graph(&s->g, bg->n, &el);
+    free_edge_list(&el);
+    s->delta = auto_delta(&s->g);
+    split_edges(&s->g, s->delta);
+    s->distance = (long long*)malloc(sizeof(long long) * (bg->n + 1));
+    return s;
+}
+
+long long run_delta(void* p, int source, int, int threads) {
+    State* s = (State*)p;
+    return delta_stepping(&s->g, source, s->delta, threads, s->distance);
+}
+
+long long run_dijkstra(void* p, int source, int, int) {
+    State* s = (State*)p;
+    dijkstra_serial(&s->g, source, s->distance);
+    return 0;
+}
+
+void result(void* p, int, long long* out) {
+    State* s = (State*)p;
+    memcpy(out, s->distance, sizeof(long long) * s->g.n);     // UNREACHABLE == NO_PATH
+}
+
+void release(void* p) {
+    State* s = (State*)p;
+    free_graph(&s->g);
+    free(s->distance);
+    free(s);
+}
+}
+#undef INF
+#undef UNREACHABLE
+#undef PRINT_LIMIT
+#undef FRONTIER_GRAIN
+#undef BUCKET_LIMIT
+#undef FALSE
+#undef TRUE
+
+/* ----- 존슨_최단경로.cpp : 병렬 Bellman-Ford, Johnson ----- */
+namespace johnson_sp {
+#include "존슨_최단경로.cpp"
+
+typedef struct State {
+    WeightedGraph g;
+    long long* distance;
+    long long** all;
+} State;
+
+void* prepare(const BenchGraph* bg) {
+    State* s = (State*)malloc(sizeof(State));
+    EdgeList el;
+    memset(&el, 0, sizeof(el));
+    for (size_t e = 0; e < bg->from.size(); e++) add_edge(&el, bg->from[e], bg->to[e], bg->weight[e]);
+    build_graph(&s->g, bg->n, &el);
+    free_edge_list(&el);
+    s->distance = (long long*)malloc(sizeof(long long) * (bg->n + 1));
+    s->all = NULL;
+    return s;
+}
+
+long long run_bellman_ford(void* p, int source, int, int threads) {
+    State* s = (State*)p;
+    return bellman_ford(&s->g, source, threads, s->distance);
+}
+
+void result_sssp(void* p, int, long long* out) {
+    State* s = (State*)p;
+    memcpy(out, s->distance, sizeof(long long) * s->g.n);     // UNREACHABLE == NO_PATH
+}
+
+long long run_johnson(void* p, int, int, int threads) {
+    State* s = (State*)p;
+    if (!s->all) s->all = alloc_matrix(s->g.n);
+    return johnson(&s->g, threads, s->all);
+}
+
+void result_all(void* p, int source, long long* out) {
+    State* s = (State*)p;
+    memcpy(out, s->all[source], sizeof(long long) * s->g.n);
+}
+
+void release(void* p) {
+    State* s = (State*)p;
+    free_graph(&s->g);
+    free(s->distance);
+    if (s->all) free_matrix(s->all);
+    free(s);
+}
+}
+#undef INF
+#undef UNREACHABLE
+#undef PRINT_LIMIT
+#undef MATRIX_PRINT_LIMIT
+#undef FLOYD_CHECK_LIMIT
+#undef CHECK_SOURCES
+#undef FRONTIER_GRAIN
+#undef FALSE
+#undef TRUE
+
+/* ----- 축약계층_최단경로.cpp : 전처리 색인 + 양방향 상향 질의 ----- */
+namespace ch {
+#include "축약계층_최단경로.cpp"
+
+typedef struct State {
+    ChIndex idx;
+    ChQuery q;
+} State;
+
+void* prepare(const BenchGraph* bg) {
+    State* s = new State;
+    EdgeInput in;
+    in.n = bg->n;
+    in.from = bg->from;
+    in.to = bg->to;
+    in.weight = bg->weight;
+    build_index(&in, &s->idx);
+    init_ch_query(&s->q, &s->idx);
+    return s;
+}
+
+long long run(void* p, int source, int target, int) {
+    return ch_query(&((State*)p)->q, source, target);       // UNREACHABLE == NO_PATH
+}
+
+void release(void* p) {
+    delete (State*)p;
+}
+}
+#undef FALSE
+#undef TRUE
+#undef UNREACHABLE
+#undef WITNESS_LIMIT
+#undef CH_MAGIC
+
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+#undef main
+
+#define FALSE 0
+#define TRUE 1
+
+/* ===== 측정할 구현 목록 ===== */
+#define KIND_SSSP 1                 // 출발점 하나 → 모든 정점
+#define KIND_P2P  2                 // 두 점 질의
+#define KIND_APSP 3                 // 모든 쌍
+
+#define LIMIT_NONE   0              // 정점 수 제한 없음
+#define LIMIT_MATRIX 1              // 인접 행렬 (n x n 메모리)
+#define LIMIT_APSP   2              // 모든 쌍 결과 (n x n 메모리, O(V^3) 또는 O(VE log V))
+#define LIMIT_CUBIC  3              // 벡터화하지 않은 O(V^3)
+#define LIMIT_CH     4              // 축약 계층 (격자만)
+
+typedef struct Algorithm {
+    const char* name;
+    int kind;
+    int threaded;                   // 스레드 수를 바꿔 가며 잴지
+    int limit;
+    void* (*prepare)(const BenchGraph* g);
+    long long (*run)(void* state, int source, int target, int threads);   // p2p 는 거리 반환
+    void (*result)(void* state, int source, long long* distance);         // sssp / apsp 의 한 행
+    void (*release)(void* state);
+} Algorithm;
+
+static const Algorithm algorithms[] = {
+    { "matrix_dijkstra",        KIND_SSSP, FALSE, LIMIT_MATRIX, matrix11::prepare, matrix11::run_sssp, matrix11::result_sssp, matrix11::release },
+    { "matrix_dijkstra_legacy", KIND_SSSP, FALSE, LIMIT_MATRIX, legacy::prepare, legacy::run_sssp, legacy::result_sssp, legacy::release },
+    { "list_dijkstra_binary",   KIND_SSSP, FALSE, LIMIT_NONE, list::prepare, list::run_binary, list::result, list::release },
+    { "list_dijkstra_4ary",     KIND_SSSP, FALSE, LIMIT_NONE, list::prepare, list::run_quaternary, list::result, list::release },
+    { "list_dijkstra_radix",    KIND_SSSP, FALSE, LIMIT_NONE, list::prepare, list::run_radix, list::result, list::release },
+    { "csr_dijkstra",           KIND_SSSP, FALSE, LIMIT_NONE, delta::prepare, delta::run_dijkstra, delta::result, delta::release },
+    { "delta_stepping",         KIND_SSSP, TRUE,  LIMIT_NONE, delta::prepare, delta::run_delta, delta::result, delta::release },
+    { "bellman_ford",           KIND_SSSP, TRUE,  LIMIT_NONE, johnson_sp::prepare, johnson_sp::run_bellman_ford, johnson_sp::result_sssp, johnson_sp::release },
+    { "list_early_exit",        KIND_P2P,  FALSE, LIMIT_NONE, list::prepare_query, list::run_early_exit, NULL, list::release },
+    { "list_bidirectional",     KIND_P2P,  FALSE, LIMIT_NONE, list::prepare_query, list::run_bidirectional, NULL, list::release },
+    { "list_astar",             KIND_P2P,  FALSE, LIMIT_NONE, list::prepare_query, list::run_astar, NULL, list::release },
+    { "contraction_hierarchy",  KIND_P2P,  FALSE, LIMIT_CH, ch::prepare, ch::run, NULL, ch::release },
+    { "floyd_blocked",          KIND_APSP, TRUE,  LIMIT_APSP, matrix11::prepare, matrix11::run_blocked, matrix11::result_all, matrix11::release },
+    { "floyd_reference",        KIND_APSP, FALSE, LIMIT_CUBIC, matrix11::prepare, matrix11::run_reference, matrix11::result_all, matrix11::release },
+    { "floyd_legacy",           KIND_APSP, FALSE, LIMIT_CUBIC, legacy::prepare, legacy::run_all, legacy::result_all, legacy::release },
+    { "johnson",                KIND_APSP, TRUE,  LIMIT_APSP, johnson_sp::prepare, johnson_sp::run_johnson, johnson_sp::result_all, johnson_sp::release },
+};
+
+static const char* kind_names[] = { "", "sssp", "p2p", "apsp" };
+
+/* ===== 실행 옵션 ===== */
+typedef struct Options {
+    const char* graphs;             // 쉼표로 구분한 생성기 이름
+    std::vector<int> sizes;
+    std::vector<int> threads;
+    int degree;
+    int max_weight;
+    unsigned long long seed;
+    int sources;
+    int queries;
+    int limit[5];                   // LIMIT_* 별 최대 정점 수
+    const char* only;               // NULL 이면 모든 구현
+    const char* out;
+} Options;
+
+/*
+    ===== 난수 (splitmix64) =====
+    - 표준 라이브러리 rand 는 플랫폼마다 결과가 달라 같은 seed 로 같은 그래프를 만들 수 없음
+*/
+typedef struct Rng {
+    unsigned long long state;
+} Rng;
+
+unsigned long long next_random(Rng* r) {
+    unsigned long long z = (r->state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+int random_below(Rng* r, int bound) {
+    return (int)(next_random(r) % (unsigned long long)bound);
+}
+
+double random_unit(Rng* r) {
+    return (double)(next_random(r) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* 이름 문자열로 seed 를 섞어 생성기와 크기마다 다른 난수열을 씀 */
+unsigned long long mix_seed(unsigned long long seed, const char* name, int n) {
+    for (const char* c = name; *c; c++) seed = seed * 131 + (unsigned char)*c;
+    return seed * 1000003ull + (unsigned long long)n;
+}
+
+void push_edge(BenchGraph* g, Rng* r, int u, int v, int max_weight) {
+    g->from.push_back(u);
+    g->to.push_back(v);
+    g->weight.push_back(1 + random_below(r, max_weight));
+}
+
+/* 정점 번호를 무작위로 섞음 (Fisher-Yates) */
+void shuffle_labels(BenchGraph* g, Rng* r) {
+    std::vector<int> label(g->n);
+    for (int v = 0; v < g->n; v++) label[v] = v;
+    for (int v = g->n - 1; v > 0; v--) std::swap(label[v], label[random_below(r, v + 1)]);
+    for (size_t e = 0; e < g->from.size(); e++) {
+        g->from[e] = label[g->from[e]];
+        g->to[e] = label[g->to[e]];
+    }
+}
+
+/* 자기 루프와 중복 간선 제거 (같은 (u, v) 는 가장 작은 가중치만 남김) */
+void simplify(BenchGraph* g) {
+    std::vector<std::pair<long long, int> > key;
+    key.reserve(g->from.size());
+    for (size_t e = 0; e < g->from.size(); e++)
+        if (g->from[e] != g->to[e])
+            key.push_back(std::make_pair((long long)g->from[e] * g->n + g->to[e], g->weight[e]));
+    std::sort(key.begin(), key.end());
+
+    g->from.clear();
+    g->to.clear();
+    g->weight.clear();
+    for (size_t i = 0; i < key.size(); i++) {
+        if (i > 0 && key[i].first == key[i - 1].first) continue;
+        g->from.push_back((int)(key[i].first / g->n));
+        g->to.push_back((int)(key[i].first % g->n));
+        g->weight.push_back(key[i].second);
+    }
+}
+
+static const char* generators[] = { "er", "rmat", "grid", "powerlaw" };
+#define GENERATOR_COUNT 4
+
+/*
+    ===== generate_graph =====
+    - n 은 요청한 정점 수 (grid 는 가장 가까운 정사각형으로 맞춤)
+    반환: 성공 0, 모르는 생성기 이름이면 -1
+*/
+int generate_graph(BenchGraph* g, const char* kind, int n, const Options* o) {
+    Rng r;
+    long long target = (long long)n * o->degree;
+
+    r.state = mix_seed(o->seed, kind, n);
+    g->kind = kind;
+    g->n = n;
+    g->from.clear();
+    g->to.clear();
+    g->weight.clear();
+
+    if (strcmp(kind, "er") == 0) {
+        for (long long e = 0; e < target; e++)
+            push_edge(g, &r, random_below(&r, n), random_below(&r, n), o->max_weight);
+    }
+    else if (strcmp(kind, "rmat") == 0) {
+        int scale = 0;
+        while ((1LL << scale) < n) scale++;
+        for (long long e = 0; e < target; ) {
+            int u = 0, v = 0;
+            for (int bit = 0; bit < scale; bit++) {     // 사분면을 a, b, c, d 확률로 골라 내려감
+                double x = random_unit(&r);
+                u = u * 2 + (x >= 0.76);                // c + d 쪽 (아래 절반)
+                v = v * 2 + ((x >= 0.57 && x < 0.76) || x >= 0.95);   // b 또는 d (오른쪽 절반)
+            }
+            if (u >= n || v >= n) continue;             // n 이 2의 거듭제곱이 아니면 범위 밖은 다시 뽑음
+            push_edge(g, &r, u, v, o->max_weight);
+            e++;
+        }
+        shuffle_labels(g, &r);
+    }
+    else if (strcmp(kind, "grid") == 0) {
+        int side = 1;
+        while ((long long)(side + 1) * (side + 1) <= n) side++;
+        g->n = side * side;
+        for (int y = 0; y < side; y++)
+            for (int x = 0; x < side; x++) {
+                int v = y * side + x;
+                if (x + 1 < side) {
+                    push_edge(g, &r, v, v + 1, o->max_weight);
+                    push_edge(g, &r, v + 1, v, o->max_weight);
+                }
+                if (y + 1 < side) {
+                    push_edge(g, &r, v, v + side, o->max_weight);
+                    push_edge(g, &r, v + side, v, o->max_weight);
+                }
+            }
+    }
+    else if (strcmp(kind, "powerlaw") == 0) {
+        std::vector<double> cumulative(n);          // 정점 i 가 끝점으로 뽑힐 누적 확률
+        double sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += pow(i + 1.0, -1.0 / (2.5 - 1.0));
+            cumulative[i] = sum;
+        }
+        for (long long e = 0; e < target; e++) {
+            int u = (int)(std::upper_bound(cumulative.begin(), cumulative.end(), random_unit(&r) * sum) - cumulative.begin());
+            int v = (int)(std::upper_bound(cumulative.begin(), cumulative.end(), random_unit(&r) * sum) - cumulative.begin());
+            push_edge(g, &r, u < n ? u : n - 1, v < n ? v : n - 1, o->max_weight);
+        }
+        shuffle_labels(g, &r);
+    }
+    else {
+        return -1;
+    }
+
+    simplify(g);
+    return 0;
+}
+
+/*
+    ===== reference_dijkstra =====
+    - 결과 비교용 기준 : 벤치마크 안에서 따로 만든 CSR + std::priority_queue 다익스트라
+*/
+void reference_dijkstra(const BenchGraph* g, const std::vector<int>& offset, const std::vector<int>& order,
+                        int source, long long* distance) {
+    typedef std::pair<long long, int> Item;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item> > pq;
+
+    for (int v = 0; v < g->n; v++) distance[v] = NO_PATH;
+    distance[source] = 0;
+    pq.push(Item(0, source));
+    while (!pq.empty()) {
+        Item top = pq.top();
+        pq.pop();
+        int u = top.second;
+        if (top.first != distance[u]) continue;
+        for (int k = offset[u]; k < offset[u + 1]; k++) {
+            int e = order[k];
+            long long nd = top.first + g->weight[e];
+            if (nd < distance[g->to[e]]) {
+                distance[g->to[e]] = nd;
+                pq.push(Item(nd, g->to[e]));
+            }
+        }
+    }
+}
+
+double seconds_since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t).count();
+}
+
+/* 쉼표로 구분한 목록에 name 이 있는지 */
+int in_list(const char* list, const char* name) {
+    size_t len = strlen(name);
+    for (const char* p = list; *p; ) {
+        const char* end = strchr(p, ',');
+        size_t item = end ? (size_t)(end - p) : strlen(p);
+        if (item == len && strncmp(p, name, len) == 0) return TRUE;
+        if (!end) break;
+        p = end + 1;
+    }
+    return FALSE;
+}
+
+/* 쉼표로 구분한 목록의 항목이 모두 생성기 이름인지 (빈 목록이나 빈 항목은 거부) */
+int valid_generators(const char* list) {
+    for (const char* p = list; ; ) {
+        const char* end = strchr(p, ',');
+        size_t item = end ? (size_t)(end - p) : strlen(p);
+        int known = FALSE;
+        for (int gi = 0; gi < GENERATOR_COUNT && !known; gi++)
+            known = item == strlen(generators[gi]) && strncmp(p, generators[gi], item) == 0;
+        if (!known) return FALSE;
+        if (!end) return TRUE;
+        p = end + 1;
+    }
+}
+
+/* "1,2,4" → {1, 2, 4}, 양수가 아닌 값이 있으면 -1 */
+int parse_numbers(const char* text, std::vector<int>* out) {
+    out->clear();
+    for (const char* p = text; *p; ) {
+        int value = atoi(p);
+        if (value <= 0) return -1;
+        out->push_back(value);
+        p = strchr(p, ',');
+        if (!p) break;
+        p++;
+    }
+    return out->empty() ? -1 : 0;
+}
+
+/*
+    ===== bench_algorithm =====
+    - 표현 구성 → (스레드 수마다) 실행 → 결과 비교 → CSV 행 출력
+    - sources : 출발점 목록, reference[i] 는 sources[i] 에서의 기준 거리
+    - targets : 두 점 질의의 도착점 (queries 개, 출발점은 sources 를 돌아가며)
+*/
+void bench_algorithm(const Algorithm* a, const BenchGraph* g, const Options* o, FILE* csv,
+                     const std::vector<int>& sources, const std::vector<std::vector<long long> >& reference,
+                     const std::vector<int>& targets) {
+    long long m = (long long)g->from.size();
+    std::vector<long long> row(g->n + 1);
+    std::vector<int> thread_counts(1, 1);
+    if (a->threaded) thread_counts = o->threads;
+
+    long long baseline = heap_live.load();
+    heap_peak.store(baseline);
+    auto t0 = std::chrono::steady_clock::now();
+    void* state = a->prepare(g);
+    double build_sec = seconds_since(t0);
+
+    std::vector<double> seconds(thread_counts.size());
+    std::vector<int> runs(thread_counts.size()), correct(thread_counts.size());
+    for (size_t k = 0; k < thread_counts.size(); k++) {
+        int threads = thread_counts[k];
+        double total = 0;
+        int ok = TRUE;
+
+        if (a->kind == KIND_SSSP) {
+            for (size_t i = 0; i < sources.size(); i++) {
+                t0 = std::chrono::steady_clock::now();
+                a->run(state, sources[i], -1, threads);
+                total += seconds_since(t0);
+                a->result(state, sources[i], &row[0]);
+                ok = ok && std::equal(reference[i].begin(), reference[i].end(), row.begin());
+            }
+            runs[k] = (int)sources.size();
+        }
+        else if (a->kind == KIND_P2P) {
+            for (size_t i = 0; i < targets.size(); i++) {
+                size_t s = i % sources.size();
+                t0 = std::chrono::steady_clock::now();
+                long long d = a->run(state, sources[s], targets[i], threads);
+                total += seconds_since(t0);
+                ok = ok && d == reference[s][targets[i]];
+            }
+            runs[k] = (int)targets.size();
+        }
+        else {
+            t0 = std::chrono::steady_clock::now();
+            a->run(state, -1, -1, threads);
+            total = seconds_since(t0);
+            for (size_t i = 0; i < sources.size(); i++) {
+                a->result(state, sources[i], &row[0]);
+                ok = ok && std::equal(reference[i].begin(), reference[i].end(), row.begin());
+            }
+            runs[k] = 1;
+        }
+        seconds[k] = total / runs[k];
+        correct[k] = ok;
+    }
+    long long memory = heap_peak.load() - baseline;
+    a->release(state);
+
+    for (size_t k = 0; k < thread_counts.size(); k++) {
+        double work = a->kind == KIND_APSP ? (double)g->n * m : (double)m;
+        fprintf(csv, "%s,%d,%lld,%s,%s,%d,%d,%.6f,%.9f,%.0f,%lld,%d\n",
+                g->kind, g->n, m, a->name, kind_names[a->kind], thread_counts[k], runs[k],
+                build_sec, seconds[k], seconds[k] > 0 ? work / seconds[k] : 0.0, memory, correct[k]);
+        fflush(csv);
+        fprintf(stderr, "  %-24s 스레드 %2d : %.6f초%s\n", a->name, thread_counts[k], seconds[k],
+                correct[k] ? "" : "  (결과 불일치)");
+    }
+}
+
+/* 이 그래프에서 a 를 잴지 (크기 제한, 축약 계층은 격자만) */
+int applies(const Algorithm* a, const BenchGraph* g, const Options* o) {
+    if (o->only && !in_list(o->only, a->name)) return FALSE;
+    if (a->limit == LIMIT_CH && strcmp(g->kind, "grid") != 0) return FALSE;
+    return a->limit == LIMIT_NONE || g->n <= o->limit[a->limit];
+}
+
+/*
+    ===== main =====
+    - 실행 인자 : 이름=값 ... (맨 위 [실행] 참고)
+*/
+int main(int argc, char** argv) {
+    Options o;
+    FILE* csv = stdout;
+    int cores = (int)std::thread::hardware_concurrency();
+
+    o.graphs = "er,rmat,grid,powerlaw";
+    parse_numbers("1024,4096,16384", &o.sizes);
+    for (int t = 1; t <= (cores > 1 ? cores : 1); t *= 2) o.threads.push_back(t);
+    o.degree = 8;
+    o.max_weight = 100;
+    o.seed = 1;
+    o.sources = 4;
+    o.queries = 100;
+    o.limit[LIMIT_NONE] = INT_MAX;
+    o.limit[LIMIT_MATRIX] = 4096;
+    o.limit[LIMIT_APSP] = 2048;
+    o.limit[LIMIT_CUBIC] = 1024;
+    o.limit[LIMIT_CH] = 65536;
+    o.only = NULL;
+    o.out = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char* eq = strchr(argv[i], '=');
+        const char* value = eq ? eq + 1 : "";
+        size_t len = eq ? (size_t)(eq - argv[i]) : strlen(argv[i]);
+        int bad = !eq;
+
+#define OPTION(name) (len == strlen(name) && strncmp(argv[i], name, len) == 0)
+        if (bad) {}
+        else if (OPTION("graphs")) bad = !valid_generators(o.graphs = value);
+        else if (OPTION("sizes")) bad = parse_numbers(value, &o.sizes) != 0;
+        else if (OPTION("threads")) bad = parse_numbers(value, &o.threads) != 0;
+        else if (OPTION("degree")) bad = (o.degree = atoi(value)) <= 0;
+        else if (OPTION("weight")) bad = (o.max_weight = atoi(value)) <= 0;
+        else if (OPTION("seed")) o.seed = strtoull(value, NULL, 10);
+        else if (OPTION("sources")) bad = (o.sources = atoi(value)) <= 0;
+        else if (OPTION("queries")) bad = (o.queries = atoi(value)) <= 0;
+        else if (OPTION("matrix")) bad = (o.limit[LIMIT_MATRIX] = atoi(value)) < 0;
+        else if (OPTION("apsp")) bad = (o.limit[LIMIT_APSP] = atoi(value)) < 0;
+        else if (OPTION("cubic")) bad = (o.limit[LIMIT_CUBIC] = atoi(value)) < 0;
+        else if (OPTION("ch")) bad = (o.limit[LIMIT_CH] = atoi(value)) < 0;
+        else if (OPTION("only")) o.only = value;
+        else if (OPTION("out")) o.out = value;
+        else bad = TRUE;
+#undef OPTION
+
+        if (bad) {
+            fprintf(stderr, "사용법: %s [graphs=er,rmat,grid,powerlaw] [sizes=1024,4096] [threads=1,2,4]\n"
+                            "       [degree=8] [weight=100] [seed=1] [sources=4] [queries=100]\n"
+                            "       [matrix=4096] [apsp=2048] [cubic=1024] [ch=65536] [only=이름,...] [out=파일]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    if (o.out && !(csv = fopen(o.out, "w"))) {
+        fprintf(stderr, "%s : 파일을 열 수 없음\n", o.out);
+        return 1;
+    }
+    fprintf(csv, "graph,n,m,algorithm,kind,threads,runs,build_seconds,seconds,edges_per_sec,memory_bytes,correct\n");
+
+    for (int gi = 0; gi < GENERATOR_COUNT; gi++) {
+        if (!in_list(o.graphs, generators[gi])) continue;
+        for (size_t si = 0; si < o.sizes.size(); si++) {
+            BenchGraph g;
+            auto t0 = std::chrono::steady_clock::now();
+            if (generate_graph(&g, generators[gi], o.sizes[si], &o) != 0) continue;
+            fprintf(stderr, "%s : 정점 %d개, 간선 %zu개 (생성 %.3f초)\n",
+                    g.kind, g.n, g.from.size(), seconds_since(t0));
+
+            // 출발점 / 도착점과 기준 거리
+            Rng r;
+            r.state = mix_seed(o.seed, "queries", g.n);
+            std::vector<int> sources(o.sources), targets(o.queries);
+            for (int i = 0; i < o.sources; i++) sources[i] = random_below(&r, g.n);
+            for (int i = 0; i < o.queries; i++) targets[i] = random_below(&r, g.n);
+
+            std::vector<int> offset(g.n + 1, 0), order(g.from.size());
+            for (size_t e = 0; e < g.from.size(); e++) offset[g.from[e] + 1]++;
+            for (int v = 0; v < g.n; v++) offset[v + 1] += offset[v];
+            std::vector<int> pos(offset.begin(), offset.end() - 1);
+            for (size_t e = 0; e < g.from.size(); e++) order[pos[g.from[e]]++] = (int)e;
+
+            std::vector<std::vector<long long> > reference(o.sources, std::vector<long long>(g.n));
+            for (int i = 0; i < o.sources; i++)
+                reference_dijkstra(&g, offset, order, sources[i], &reference[i][0]);
+
+            for (size_t a = 0; a < sizeof(algorithms) / sizeof(algorithms[0]); a++)
+                if (applies(&algorithms[a], &g, &o))
+                    bench_algorithm(&algorithms[a], &g, &o, csv, sources, reference, targets);
+        }
+    }
+
+    if (csv != stdout) fclose(csv);
+    return 0;
+}
@@ -10,6 +10,8 @@ typedef struct GraphType {
 } GraphType;
 
 int visited[MAX_VERTICES];
+int pre_order[MAX_VERTICES];	//  ó 湮 ð
+int post_order[MAX_VERTICES];	//     Ȯ ð
 
 // ׷ ʱȭ 
 void init(GraphType* g)
@@ -40,14 +42,35 @@ void insert_edge(GraphType* g, int start, int end)
 	g->adj_mat[end][start] = 1;
 }
 //  ķ ǥ ׷   켱 Ž
+//   (,  Ȯ )  ÿ ״´.
+// 湮    ,  Ƶ ȣ  ġ ʴ´.
 void dfs_mat(GraphType* g, int v)
 {
-	int w;
+	int stack_v[MAX_VERTICES], stack_w[MAX_VERTICES];
+	int top = 0, clock = 0, w;
+
 	visited[v] = TRUE;		//  v 湮 ǥ 
+	pre_order[v] = clock++;
 	printf(" %d -> ", v);		// 湮  
-	for (w = 0; w<g->n; w++) 		//   Ž
-		if (g->adj_mat[v][w] && !visited[w])
-			dfs_mat(g, w);	// w DFS  
+	stack_v[top] = v;
+	stack_w[top++] = 0;
+	while (top > 0) {
+		v = stack_v[top - 1];
+		for (w = stack_w[top - 1]; w<g->n; w++) 	//   Ž
+			if (g->adj_mat[v][w] && !visited[w])
+				break;
+		if (w == g->n) {		//     ǵư
+			post_order[v] = clock++;
+			top--;
+			continue;
+		}
+		stack_w[top - 1] = w + 1;	// ƿ w   Ž
+		visited[w] = TRUE;
+		pre_order[w] = clock++;
+		printf(" %d -> ", w);
+		stack_v[top] = w;		// w DFS  
+		stack_w[top++] = 0;
+	}
 }
 int main(void)
 {
@@ -65,6 +88,8 @@ int main(void)
 	printf(" 켱 Ž\n");
 	dfs_mat(g, 0);
 	printf("\n");
+	for (int i = 0; i < g->n; i++)
+		printf(" %d: 湮 %d,  %d\n", i, pre_order[i], post_order[i]);
 	free(g);
 	return 0;
 }
\ No newline at end of file
@@ -3,15 +3,38 @@
 
 #define TRUE 1
 #define FALSE 0
-#define MAX_VERTICES	100	
 #define INF	1000000	/* Ѵ (  ) */
 
+/*
+	     Ҵ (MAX_VERTICES  )
+	- n x n ĭ     ͸ ̹Ƿ A[i][j]  ״ 
+*/
 typedef struct GraphType {
 	int n;	//  
-	int weight[MAX_VERTICES][MAX_VERTICES];
+	int** weight;
 } GraphType;
 
-int A[MAX_VERTICES][MAX_VERTICES];
+int** A;
+
+int** alloc_matrix(int n)
+{
+	int i;
+	int** m = (int**)malloc(sizeof(int*) * n);
+	int* block = (int*)malloc(sizeof(int) * n * n);
+	if (m == NULL || block == NULL) {
+		fprintf(stderr, "޸ Ҵ \n");
+		exit(1);
+	}
+	for (i = 0; i < n; i++)
+		m[i] = block + i * n;
+	return m;
+}
+
+void free_matrix(int** m)
+{
+	free(m[0]);
+	free(m);
+}
 
 void printA(GraphType *g)
 {
@@ -28,6 +51,12 @@ void printA(GraphType *g)
 	printf("===============================\n");
 }
 
+/*
+	  б⸦ 
+	- A[i][k]  j    Ƿ  ,
+	  A[i][k]  INF    ٲ   ǳʶ
+	-    min   (INF + INF  int )  Ϸ ȭ 
+*/
 void floyd(GraphType* g)
 {
 
@@ -38,25 +67,43 @@ void floyd(GraphType* g)
 	printA(g);
 
 	for (k = 0; k<g->n; k++) {
-		for (i = 0; i<g->n; i++)
-			for (j = 0; j<g->n; j++)
-				if (A[i][k] + A[k][j] < A[i][j])
-					A[i][j] = A[i][k] + A[k][j];
+		for (i = 0; i<g->n; i++) {
+			int aik = A[i][k];
+			int* ai = A[i];
+			int* ak = A[k];
+			if (aik == INF) continue;
+			for (j = 0; j<g->n; j++) {
+				int sum = aik + ak[j];
+				ai[j] = sum < ai[j] ? sum : ai[j];
+			}
+		}
 		printA(g);
 	}
 }
 
 int main(void)
 {
-	GraphType g = { 7,
-	{{ 0,  7,  INF, INF,   3,  10, INF },
+	static const int w[7][7] = {
+	{ 0,  7,  INF, INF,   3,  10, INF },
 	{ 7,  0,    4,  10,   2,   6, INF },
 	{ INF,  4,    0,   2, INF, INF, INF },
 	{ INF, 10,    2,   0,  11,   9,   4 },
 	{ 3,  2,  INF,  11,   0, INF,   5 },
 	{ 10,  6,  INF,   9, INF,   0, INF },
-	{ INF, INF, INF,   4,   5, INF,   0 } }
-	};
+	{ INF, INF, INF,   4,   5, INF,   0 } };
+	GraphType g;
+	int i, j;
+
+	g.n = 7;
+	g.weight = alloc_matrix(g.n);
+	A = alloc_matrix(g.n);
+	for (i = 0; i < g.n; i++)
+		for (j = 0; j < g.n; j++)
+			g.weight[i][j] = w[i][j];
+
 	floyd(&g);
+
+	free_matrix(g.weight);
+	free_matrix(A);
 	return 0;
 }
\ No newline at end of file
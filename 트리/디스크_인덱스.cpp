@@ -0,0 +1,528 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+    ===== 메모리 매핑(mmap) 가능한 디스크 BST 인덱스 =====
+
+    [문제]
+    - 9장.cpp, english_dic.c 의 BST는 실행할 때마다 malloc으로 새로 만든다.
+    - 포인터는 프로세스마다 주소가 달라서 그대로 파일에 쓸 수 없다.
+
+    [파일 형식]
+    - 트리를 한 번 만든 뒤 중위 순회 순서로 꺼내서,
+      균형 잡힌 모양으로 배열에 다시 배치하여 파일로 저장한다.
+    - 자식 연결은 포인터 대신 "노드 배열의 인덱스"(NIL = 없음)를 사용
+      → 파일이 어느 주소에 매핑되더라도 그대로 사용 가능 (position-independent)
+    - 문자열은 뒤쪽 문자열 영역의 오프셋으로 가리킨다.
+
+        [IndexHeader][노드 배열 ...][문자열 영역 ...]
+
+    - 열 때는 mmap 한 번으로 끝나며 역직렬화 과정이 없다.
+      여러 프로세스가 같은 파일을 열면 페이지 캐시를 공유한다.
+    - 정수는 기록한 기계의 바이트 순서(little endian 가정) 그대로 저장한다.
+*/
+
+#define INDEX_MAGIC 0x31584449u     // "IDX1"
+#define INDEX_INT   1               // (int key, double value) 인덱스
+#define INDEX_DIC   2               // (word, meaning) 사전 인덱스
+#define NIL         0xFFFFFFFFu     // 자식 없음
+#define MAX_WORD_SIZE    100
+#define MAX_MEANING_SIZE 200
+
+/* ===== 디스크 레이아웃 (모두 고정 폭 정수) ===== */
+typedef struct IndexHeader {
+    uint32_t magic;
+    uint32_t kind;          // INDEX_INT / INDEX_DIC
+    uint32_t node_count;
+    uint32_t root;          // 루트 노드 인덱스 (빈 트리면 NIL)
+    uint64_t node_offset;   // 파일 시작부터 노드 배열까지의 바이트
+    uint64_t string_offset; // 문자열 영역 시작 (INDEX_DIC만 사용)
+    uint64_t file_size;
+} IndexHeader;
+
+typedef struct DiskIntNode {
+    int32_t key;
+    uint32_t left, right;
+    uint32_t pad;           // value를 8바이트 경계에 맞춤
+    double value;
+} DiskIntNode;
+
+typedef struct DiskDicNode {
+    uint32_t word;          // 문자열 영역 내 오프셋
+    uint32_t meaning;
+    uint32_t left, right;
+} DiskDicNode;
+
+/* ===== 메모리 상의 BST (9장.cpp / english_dic.c 와 같은 구조) ===== */
+typedef struct node* treePointer;
+typedef struct node {
+    int key;
+    double value;
+    treePointer leftChild, rightChild;
+} node;
+
+typedef struct TreeNode {
+    char word[MAX_WORD_SIZE];
+    char meaning[MAX_MEANING_SIZE];
+    struct TreeNode *left, *right;
+} TreeNode;
+
+void insert(treePointer* root, int k, double value) {
+    treePointer* link = root;
+    while (*link) {
+        if (k == (*link)->key) return;
+        link = (k < (*link)->key) ? &(*link)->leftChild : &(*link)->rightChild;
+    }
+    treePointer p = (treePointer)malloc(sizeof(node));
+    p->key = k;
+    p->value = value;
+    p->leftChild = p->rightChild = NULL;
+    *link = p;
+}
+
+void insert_word(TreeNode** root, const char* word, const char* meaning) {
+    TreeNode** link = root;
+    while (*link) {
+        int c = strcmp(word, (*link)->word);
+        if (c == 0) return;
+        link = (c < 0) ? &(*link)->left : &(*link)->right;
+    }
+    TreeNode* p = (TreeNode*)calloc(1, sizeof(TreeNode));
+    strncpy(p->word, word, MAX_WORD_SIZE - 1);
+    strncpy(p->meaning, meaning, MAX_MEANING_SIZE - 1);
+    *link = p;
+}
+
+int count_node(treePointer p) {
+    return p ? 1 + count_node(p->leftChild) + count_node(p->rightChild) : 0;
+}
+
+int count_words(TreeNode* p) {
+    return p ? 1 + count_words(p->left) + count_words(p->right) : 0;
+}
+
+void delete_tree(treePointer p) {
+    if (p) {
+        delete_tree(p->leftChild);
+        delete_tree(p->rightChild);
+        free(p);
+    }
+}
+
+void delete_words(TreeNode* p) {
+    if (p) {
+        delete_words(p->left);
+        delete_words(p->right);
+        free(p);
+    }
+}
+
+/* 중위 순회 순서로 노드 포인터를 배열에 모음 (반복, 스택 사용) */
+int collect_inorder(treePointer root, treePointer* out, int count) {
+    treePointer* stack = (treePointer*)malloc(sizeof(treePointer) * (count + 1));
+    int top = 0, n = 0;
+    treePointer p = root;
+    while (p || top) {
+        for (; p; p = p->leftChild) stack[top++] = p;
+        p = stack[--top];
+        out[n++] = p;
+        p = p->rightChild;
+    }
+    free(stack);
+    return n;
+}
+
+int collect_words(TreeNode* root, TreeNode** out, int count) {
+    TreeNode** stack = (TreeNode**)malloc(sizeof(TreeNode*) * (count + 1));
+    int top = 0, n = 0;
+    TreeNode* p = root;
+    while (p || top) {
+        for (; p; p = p->left) stack[top++] = p;
+        p = stack[--top];
+        out[n++] = p;
+        p = p->right;
+    }
+    free(stack);
+    return n;
+}
+
+/*
+    ===== 균형 배치 =====
+    정렬된 [lo, hi) 구간의 가운데를 루트로 하여 전위 순서로 배열에 놓는다.
+    - 전위 순서라서 루트 근처의 노드들이 파일 앞쪽 같은 페이지에 모인다.
+    - 반환값: 배치된 서브트리 루트의 인덱스 (빈 구간이면 NIL)
+*/
+uint32_t layout_int(treePointer* sorted, int lo, int hi, DiskIntNode* out, uint32_t* next) {
+    if (lo >= hi) return NIL;
+    int mid = lo + (hi - lo) / 2;
+    uint32_t me = (*next)++;
+
+    out[me].key = sorted[mid]->key;
+    out[me].value = sorted[mid]->value;
+    out[me].pad = 0;
+    out[me].left = layout_int(sorted, lo, mid, out, next);
+    out[me].right = layout_int(sorted, mid + 1, hi, out, next);
+    return me;
+}
+
+uint32_t layout_dic(TreeNode** sorted, int lo, int hi, DiskDicNode* out,
+                    uint32_t* next, const uint32_t* word_off) {
+    if (lo >= hi) return NIL;
+    int mid = lo + (hi - lo) / 2;
+    uint32_t me = (*next)++;
+
+    out[me].word = word_off[mid];
+    out[me].meaning = word_off[mid] + (uint32_t)strlen(sorted[mid]->word) + 1;
+    out[me].left = layout_dic(sorted, lo, mid, out, next, word_off);
+    out[me].right = layout_dic(sorted, mid + 1, hi, out, next, word_off);
+    return me;
+}
+
+/*
+    ===== write_int_index =====
+    정수 키 BST를 인덱스 파일로 기록
+    반환: 성공 0, 실패 -1
+*/
+int write_int_index(treePointer root, const char* path) {
+    int count = count_node(root);
+    treePointer* sorted = (treePointer*)malloc(sizeof(treePointer) * (count + 1));
+    DiskIntNode* nodes = (DiskIntNode*)calloc(count + 1, sizeof(DiskIntNode));
+    IndexHeader h;
+    uint32_t next = 0;
+    FILE* fp;
+    int ok;
+
+    collect_inorder(root, sorted, count);
+
+    memset(&h, 0, sizeof(h));
+    h.magic = INDEX_MAGIC;
+    h.kind = INDEX_INT;
+    h.node_count = (uint32_t)count;
+    h.root = layout_int(sorted, 0, count, nodes, &next);
+    h.node_offset = sizeof(IndexHeader);
+    h.string_offset = h.node_offset + sizeof(DiskIntNode) * (uint64_t)count;
+    h.file_size = h.string_offset;
+
+    fp = fopen(path, "wb");
+    ok = fp != NULL;
+    if (fp) {
+        ok = fwrite(&h, sizeof(h), 1, fp) == 1 &&
+             fwrite(nodes, sizeof(DiskIntNode), count, fp) == (size_t)count;
+        ok = (fclose(fp) == 0) && ok;   // 버퍼에 남은 내용은 fclose 에서 기록됨
+    }
+    free(sorted);
+    free(nodes);
+    return ok ? 0 : -1;
+}
+
+/*
+    ===== write_dic_index =====
+    사전 BST를 인덱스 파일로 기록
+    - 문자열 영역에는 "word\0meaning\0" 이 정렬 순서대로 들어감
+*/
+int write_dic_index(TreeNode* root, const char* path) {
+    int count = count_words(root);
+    TreeNode** sorted = (TreeNode**)malloc(sizeof(TreeNode*) * (count + 1));
+    uint32_t* word_off = (uint32_t*)malloc(sizeof(uint32_t) * (count + 1));
+    DiskDicNode* nodes = (DiskDicNode*)calloc(count + 1, sizeof(DiskDicNode));
+    IndexHeader h;
+    uint32_t next = 0, strings = 0;
+    FILE* fp;
+    int ok;
+
+    collect_words(root, sorted, count);
+    for (int i = 0; i < count; i++) {
+        word_off[i] = strings;
+        strings += (uint32_t)(strlen(sorted[i]->word) + strlen(sorted[i]->meaning) + 2);
+    }
+
+    memset(&h, 0, sizeof(h));
+    h.magic = INDEX_MAGIC;
+    h.kind = INDEX_DIC;
+    h.node_count = (uint32_t)count;
+    h.root = layout_dic(sorted, 0, count, nodes, &next, word_off);
+    h.node_offset = sizeof(IndexHeader);
+    h.string_offset = h.node_offset + sizeof(DiskDicNode) * (uint64_t)count;
+    h.file_size = h.string_offset + strings;
+
+    fp = fopen(path, "wb");
+    ok = fp != NULL;
+    if (fp) {
+        ok = fwrite(&h, sizeof(h), 1, fp) == 1 &&
+             fwrite(nodes, sizeof(DiskDicNode), count, fp) == (size_t)count;
+        for (int i = 0; ok && i < count; i++) {
+            size_t wlen = strlen(sorted[i]->word) + 1, mlen = strlen(sorted[i]->meaning) + 1;
+            ok = fwrite(sorted[i]->word, 1, wlen, fp) == wlen &&
+                 fwrite(sorted[i]->meaning, 1, mlen, fp) == mlen;
+        }
+        ok = (fclose(fp) == 0) && ok;
+    }
+    free(sorted);
+    free(word_off);
+    free(nodes);
+    return ok ? 0 : -1;
+}
+
+/* ===== 매핑된 인덱스 ===== */
+typedef struct MappedIndex {
+    const unsigned char* base;  // 매핑 시작 주소
+    size_t size;
+    const IndexHeader* header;
+#ifdef _WIN32
+    HANDLE file, mapping;
+#endif
+} MappedIndex;
+
+void close_index(MappedIndex* idx);
+
+/* 문자열 영역 안의 오프셋이고 영역이 끝나기 전에 '\0' 이 있는지 */
+int valid_string(const char* strings, uint64_t string_size, uint32_t off) {
+    return off < string_size && memchr(strings + off, '\0', (size_t)(string_size - off)) != NULL;
+}
+
+/*
+    ===== validate_index =====
+    매핑된 내용이 헤더가 말하는 구조와 맞는지 검사 (손상되거나 조작된 파일 대비)
+    - 노드 배열 : [node_offset, string_offset) 안에 들어가고 노드 크기에 맞게 정렬
+    - 자식 인덱스 : 전위 순서로 배치했으므로 자식은 항상 부모보다 뒤 (i < 자식 < node_count)
+      → 검색이 순환하지 않고 반드시 끝남
+    - 사전 문자열 : 문자열 영역 안에서 '\0' 으로 끝남
+    반환: 올바르면 0, 아니면 -1
+*/
+int validate_index(const MappedIndex* idx, uint32_t kind) {
+    const IndexHeader* h = idx->header;
+    uint64_t node_size = kind == INDEX_INT ? sizeof(DiskIntNode) : sizeof(DiskDicNode);
+    uint64_t count = h->node_count;
+
+    if (h->node_offset < sizeof(IndexHeader) || h->node_offset > idx->size ||
+        h->node_offset % sizeof(uint64_t) != 0 ||
+        h->string_offset > idx->size ||
+        h->node_offset + count * node_size > h->string_offset)
+        return -1;
+    if (count == 0 ? h->root != NIL : h->root >= count)
+        return -1;
+
+    if (kind == INDEX_INT) {
+        const DiskIntNode* nodes = (const DiskIntNode*)(idx->base + h->node_offset);
+        for (uint32_t i = 0; i < count; i++) {
+            if ((nodes[i].left != NIL && (nodes[i].left <= i || nodes[i].left >= count)) ||
+                (nodes[i].right != NIL && (nodes[i].right <= i || nodes[i].right >= count)))
+                return -1;
+        }
+    }
+    else {
+        const DiskDicNode* nodes = (const DiskDicNode*)(idx->base + h->node_offset);
+        const char* strings = (const char*)(idx->base + h->string_offset);
+        uint64_t string_size = idx->size - h->string_offset;
+        for (uint32_t i = 0; i < count; i++) {
+            if ((nodes[i].left != NIL && (nodes[i].left <= i || nodes[i].left >= count)) ||
+                (nodes[i].right != NIL && (nodes[i].right <= i || nodes[i].right >= count)) ||
+                !valid_string(strings, string_size, nodes[i].word) ||
+                !valid_string(strings, string_size, nodes[i].meaning))
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+    ===== open_index =====
+    파일을 읽기 전용으로 매핑하고 헤더와 노드 배열을 검사
+    - 검사는 열 때 한 번 O(노드 수 + 문자열 크기), 검색은 검사 없이 바로 따라감
+    반환: 성공 0, 실패 -1
+*/
+int open_index(MappedIndex* idx, const char* path, uint32_t kind) {
+    memset(idx, 0, sizeof(*idx));
+
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    idx->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (idx->file == INVALID_HANDLE_VALUE) return -1;
+    GetFileSizeEx(idx->file, &size);
+    idx->size = (size_t)size.QuadPart;
+    idx->mapping = CreateFileMappingA(idx->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!idx->mapping) {
+        CloseHandle(idx->file);
+        return -1;
+    }
+    idx->base = (const unsigned char*)MapViewOfFile(idx->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!idx->base) {
+        CloseHandle(idx->mapping);
+        CloseHandle(idx->file);
+        return -1;
+    }
+#else
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(IndexHeader)) {
+        close(fd);
+        return -1;
+    }
+    idx->size = (size_t)st.st_size;
+    void* p = mmap(NULL, idx->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // 매핑은 fd를 닫아도 유지됨
+    if (p == MAP_FAILED) return -1;
+    idx->base = (const unsigned char*)p;
+#endif
+
+    idx->header = (const IndexHeader*)idx->base;
+    if (idx->size < sizeof(IndexHeader) || idx->header->magic != INDEX_MAGIC ||
+        idx->header->kind != kind || idx->header->file_size != idx->size ||
+        validate_index(idx, kind) != 0) {
+        fprintf(stderr, "인덱스 파일 형식 오류: %s\n", path);
+        close_index(idx);
+        return -1;
+    }
+    return 0;
+}
+
+void close_index(MappedIndex* idx) {
+    if (!idx->base) return;
+#ifdef _WIN32
+    UnmapViewOfFile(idx->base);
+    CloseHandle(idx->mapping);
+    CloseHandle(idx->file);
+#else
+    munmap((void*)idx->base, idx->size);
+#endif
+    idx->base = NULL;
+}
+
+/*
+    ===== 매핑된 파일에서 바로 검색 =====
+    - 포인터 대신 base + offset 으로 노드를 찾아감
+    - count에는 방문한 노드 수를 기록 (9장의 search_count 와 같은 의미)
+*/
+const DiskIntNode* search_int_index(const MappedIndex* idx, int key, int* count) {
+    const DiskIntNode* nodes = (const DiskIntNode*)(idx->base + idx->header->node_offset);
+    uint32_t i = idx->header->root;
+
+    *count = 0;
+    while (i != NIL) {
+        const DiskIntNode* p = &nodes[i];
+        (*count)++;
+        if (key == p->key) return p;
+        i = (key < p->key) ? p->left : p->right;
+    }
+    return NULL;
+}
+
+const char* search_dic_index(const MappedIndex* idx, const char* word) {
+    const DiskDicNode* nodes = (const DiskDicNode*)(idx->base + idx->header->node_offset);
+    const char* strings = (const char*)(idx->base + idx->header->string_offset);
+    uint32_t i = idx->header->root;
+
+    while (i != NIL) {
+        const DiskDicNode* p = &nodes[i];
+        int c = strcmp(word, strings + p->word);   // 레벨당 비교 1회
+        if (c == 0) return strings + p->meaning;
+        i = (c < 0) ? p->left : p->right;
+    }
+    return NULL;
+}
+
+/* "단어<TAB>뜻" 파일로 사전 BST 생성 */
+TreeNode* load_words(const char* path) {
+    char line[MAX_WORD_SIZE + MAX_MEANING_SIZE + 2];
+    TreeNode* root = NULL;
+    FILE* fp = fopen(path, "r");
+
+    if (!fp) return NULL;
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char* tab = strchr(line, '\t');
+        if (!tab || tab == line) continue;
+        *tab = '\0';
+        insert_word(&root, line, tab + 1);
+    }
+    fclose(fp);
+    return root;
+}
+
+int main(void) {
+    const char* int_path = "bst.idx";
+    const char* dic_path = "dic.idx";
+    MappedIndex idx;
+    char path[256], word[MAX_WORD_SIZE];
+    int n;
+
+    srand((unsigned int)time(NULL));
+
+    /*
+        1) 정수 키 인덱스: n개 키로 BST 생성 → 파일 기록 → mmap 후 검색
+    */
+    printf("1. 정수 키 BST 인덱스\n  노드 수 (n) : ");
+    if (scanf("%d", &n) != 1 || n < 0) return 0;
+
+    treePointer root = NULL;
+    int* keys = (int*)malloc(sizeof(int) * (n + 1));
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(((unsigned)rand() << 15 ^ (unsigned)rand()) % 100000000u) + 1;
+        insert(&root, keys[i], 1.0 / keys[i]);
+    }
+
+    clock_t start = clock();
+    if (write_int_index(root, int_path) != 0) {
+        fprintf(stderr, "%s 기록 실패\n", int_path);
+        return 1;
+    }
+    printf("  인덱스 기록 시간 : %.3f초\n", (double)(clock() - start) / CLOCKS_PER_SEC);
+    delete_tree(root);
+
+    start = clock();
+    if (open_index(&idx, int_path, INDEX_INT) != 0) return 1;
+    printf("  인덱스 열기 시간 : %.6f초 (노드 %u개)\n",
+           (double)(clock() - start) / CLOCKS_PER_SEC, idx.header->node_count);
+
+    long long total_count = 0;
+    int missing = 0, count;
+    for (int i = 0; i < n; i++) {
+        const DiskIntNode* p = search_int_index(&idx, keys[i], &count);
+        if (!p || p->value != 1.0 / keys[i]) missing++;
+        total_count += count;
+    }
+    printf("  전체 키 검색: 실패 %d개, 평균 방문 노드 수 %.2f\n",
+           missing, n ? (double)total_count / n : 0.0);
+    close_index(&idx);
+    free(keys);
+
+    /*
+        2) 사전 인덱스: "단어<TAB>뜻" 파일 → 파일 기록 → mmap 후 검색
+    */
+    printf("\n2. 사전 인덱스\n  사전 파일 (단어<TAB>뜻) : ");
+    if (scanf("%255s", path) != 1) return 0;
+
+    TreeNode* words = load_words(path);
+    if (!words || write_dic_index(words, dic_path) != 0) {
+        fprintf(stderr, "%s 처리 실패\n", path);
+        delete_words(words);
+        return 1;
+    }
+    delete_words(words);
+
+    if (open_index(&idx, dic_path, INDEX_DIC) != 0) return 1;
+    while (1) {
+        printf("  단어 (종료: -1) : ");
+        if (scanf("%99s", word) != 1 || strcmp(word, "-1") == 0) break;
+        const char* meaning = search_dic_index(&idx, word);
+        if (meaning) printf("  의미:%s\n", meaning);
+        else printf("  없는 단어입니다.\n");
+    }
+    close_index(&idx);
+    return 0;
+}
@@ -0,0 +1,433 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    ===== 기수 트리(Radix Tree)를 이용한 영어 사전 =====
+
+    [책 예제/트리/english_dic.c 와의 차이]
+    - english_dic.c 는 노드마다 word[100], meaning[200] 고정 배열을 두어
+      실제 문자열 길이와 관계없이 노드당 300바이트 이상을 사용한다.
+    - 여기서는 문자열을 아레나(arena)에 가변 길이로 이어 붙여 저장하고,
+      트리 노드에는 포인터와 길이만 둔다.
+
+    [기수 트리 (압축 트라이)]
+    - 간선에 문자열 조각(label)을 붙이고, 자식이 하나뿐인 경로는
+      하나의 간선으로 합친다 (prefix compression).
+    - 자식은 label 첫 글자 기준으로 정렬되어 있어서
+      레벨마다 "첫 글자 한 번 비교 + label memcmp 한 번"으로 내려간다.
+    - 정렬된 자식 순서대로 순회하면 사전순 출력이 된다.
+    - 접두사 검색: 접두사에 해당하는 노드까지 내려간 뒤 그 서브트리만 순회.
+*/
+
+#define ARENA_BLOCK_SIZE (1 << 20)  // 아레나 블록 하나의 크기 (1MB)
+#define MAX_LINE_SIZE 4096
+
+/* ===== 아레나: 큰 블록을 잘라 쓰는 할당기 ===== */
+typedef struct arena_block {
+    struct arena_block* next;
+    size_t used;
+    size_t capacity;
+    char data[1];               // 실제로는 capacity 바이트
+} arena_block;
+
+typedef struct arena {
+    arena_block* head;          // 현재 할당 중인 블록
+    size_t total;               // 블록으로 확보한 전체 바이트
+} arena;
+
+void* arena_alloc(arena* a, size_t size) {
+    size = (size + 7) & ~(size_t)7;     // 8바이트 정렬
+
+    if (!a->head || a->head->used + size > a->head->capacity) {
+        size_t cap = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        arena_block* b = (arena_block*)malloc(sizeof(arena_block) + cap);
+        if (!b) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+        b->next = a->head;
+        b->used = 0;
+        b->capacity = cap;
+        a->head = b;
+        a->total += cap;
+    }
+
+    void* p = a->head->data + a->head->used;
+    a->head->used += size;
+    return p;
+}
+
+/* len 바이트를 아레나에 복사 (널 문자 포함) */
+char* arena_strndup(arena* a, const char* s, size_t len) {
+    char* p = (char*)arena_alloc(a, len + 1);
+    memcpy(p, s, len);
+    p[len] = '\0';
+    return p;
+}
+
+void arena_free(arena* a) {
+    arena_block* b = a->head;
+    while (b) {
+        arena_block* next = b->next;
+        free(b);
+        b = next;
+    }
+    a->head = NULL;
+    a->total = 0;
+}
+
+/* ===== 기수 트리 노드 ===== */
+typedef struct RadixNode {
+    const char* label;          // 부모에서 이 노드로 오는 간선 문자열 (아레나)
+    int label_len;
+    const char* meaning;        // 단어의 끝이면 뜻, 아니면 NULL
+    struct RadixNode** child;   // label 첫 글자 순으로 정렬된 자식 배열
+    int child_count;
+    int child_capacity;
+} RadixNode;
+
+typedef struct Dictionary {
+    RadixNode root;             // label이 빈 문자열인 루트
+    arena strings;              // label / meaning 저장소
+    arena nodes;                // 노드 저장소
+    int word_count;
+} Dictionary;
+
+void dic_init(Dictionary* d) {
+    memset(d, 0, sizeof(*d));
+    d->root.label = "";
+}
+
+RadixNode* new_radix_node(Dictionary* d, const char* label, int len) {
+    RadixNode* p = (RadixNode*)arena_alloc(&d->nodes, sizeof(RadixNode));
+    memset(p, 0, sizeof(*p));
+    p->label = label;
+    p->label_len = len;
+    return p;
+}
+
+/*
+    ===== find_child =====
+    첫 글자가 c인 자식의 위치를 이진 탐색
+    - 찾으면 인덱스, 없으면 -(삽입 위치) - 1 반환
+*/
+int find_child(RadixNode* p, unsigned char c) {
+    int lo = 0, hi = p->child_count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        unsigned char m = (unsigned char)p->child[mid]->label[0];
+        if (m == c) return mid;
+        if (m < c) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return -lo - 1;
+}
+
+void insert_child(RadixNode* p, int pos, RadixNode* c) {
+    if (p->child_count == p->child_capacity) {
+        p->child_capacity = p->child_capacity ? p->child_capacity * 2 : 2;
+        p->child = (RadixNode**)realloc(p->child, p->child_capacity * sizeof(RadixNode*));
+        if (!p->child) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+    }
+    memmove(p->child + pos + 1, p->child + pos, (p->child_count - pos) * sizeof(RadixNode*));
+    p->child[pos] = c;
+    p->child_count++;
+}
+
+/* a, b의 공통 접두사 길이 (최대 n) */
+int common_prefix(const char* a, const char* b, int n) {
+    int i = 0;
+    while (i < n && a[i] == b[i]) i++;
+    return i;
+}
+
+/*
+    ===== dic_insert =====
+    - 이미 있는 단어면 뜻만 교체
+    - label 중간에서 갈라지면 노드를 분할(split)
+*/
+void dic_insert(Dictionary* d, const char* word, const char* meaning) {
+    RadixNode* p = &d->root;
+    int len = (int)strlen(word);
+    const char* m = arena_strndup(&d->strings, meaning, strlen(meaning));
+
+    while (len > 0) {
+        int pos = find_child(p, (unsigned char)word[0]);
+
+        // 첫 글자가 같은 자식이 없으면 남은 문자열 전체를 새 간선으로
+        if (pos < 0) {
+            RadixNode* leaf = new_radix_node(d, arena_strndup(&d->strings, word, len), len);
+            leaf->meaning = m;
+            insert_child(p, -pos - 1, leaf);
+            d->word_count++;
+            return;
+        }
+
+        RadixNode* c = p->child[pos];
+        int k = common_prefix(c->label, word, len < c->label_len ? len : c->label_len);
+
+        // label 중간에서 갈라짐 -> c를 [공통 부분] + [나머지]로 분할
+        if (k < c->label_len) {
+            RadixNode* mid = new_radix_node(d, c->label, k);
+            c->label += k;
+            c->label_len -= k;
+            insert_child(mid, 0, c);
+            p->child[pos] = mid;
+            c = mid;
+        }
+
+        p = c;
+        word += k;
+        len -= k;
+    }
+
+    if (!p->meaning) d->word_count++;
+    p->meaning = m;
+}
+
+/*
+    ===== descend =====
+    key를 끝까지 따라 내려간 노드 반환
+    - exact가 1이면 key가 노드 경계에서 정확히 끝나야 함
+    - exact가 0이면 key가 어떤 간선 중간에서 끝나도 그 간선의 노드 반환
+      (*rest에 간선에서 key 이후에 남은 label 길이를 기록)
+*/
+RadixNode* descend(Dictionary* d, const char* key, int exact, int* rest) {
+    RadixNode* p = &d->root;
+    int len = (int)strlen(key);
+
+    *rest = 0;
+    while (len > 0) {
+        int pos = find_child(p, (unsigned char)key[0]);
+        if (pos < 0) return NULL;
+
+        RadixNode* c = p->child[pos];
+        int n = len < c->label_len ? len : c->label_len;
+        if (memcmp(c->label, key, n) != 0) return NULL;
+
+        if (len < c->label_len) {   // key가 간선 중간에서 끝남
+            if (exact) return NULL;
+            *rest = c->label_len - len;
+            return c;
+        }
+        p = c;
+        key += n;
+        len -= n;
+    }
+    return p;
+}
+
+const char* dic_search(Dictionary* d, const char* word) {
+    int rest;
+    RadixNode* p = descend(d, word, 1, &rest);
+    return p ? p->meaning : NULL;
+}
+
+/*
+    ===== dic_delete =====
+    - 뜻을 지우고, 자식이 없어진 노드는 부모에서 떼어냄
+    - 뜻이 없고 자식이 하나뿐인 노드는 자식과 합쳐 압축 상태 유지
+      (노드 메모리는 아레나에 남지만 dic_compact 없이도 검색에는 영향 없음)
+*/
+int dic_delete(Dictionary* d, const char* word) {
+    RadixNode* path[MAX_LINE_SIZE];
+    int path_pos[MAX_LINE_SIZE];
+    int depth = 0;
+    RadixNode* p = &d->root;
+    int len = (int)strlen(word);
+
+    while (len > 0) {
+        int pos = find_child(p, (unsigned char)word[0]);
+        if (pos < 0) return 0;
+        RadixNode* c = p->child[pos];
+        if (len < c->label_len || memcmp(c->label, word, c->label_len) != 0) return 0;
+
+        path[depth] = p;
+        path_pos[depth++] = pos;
+        word += c->label_len;
+        len -= c->label_len;
+        p = c;
+    }
+    if (!p->meaning) return 0;
+
+    p->meaning = NULL;
+    d->word_count--;
+
+    // 아래에서 위로 올라가며 불필요해진 노드 정리
+    while (depth > 0) {
+        RadixNode* parent = path[--depth];
+        int pos = path_pos[depth];
+        RadixNode* c = parent->child[pos];
+
+        if (c->meaning) break;
+        if (c->child_count == 0) {
+            free(c->child);
+            memmove(parent->child + pos, parent->child + pos + 1,
+                    (parent->child_count - pos - 1) * sizeof(RadixNode*));
+            parent->child_count--;
+            continue;   // 부모도 정리 대상이 될 수 있음
+        }
+        if (c->child_count == 1) {
+            RadixNode* only = c->child[0];
+            int n = c->label_len + only->label_len;
+            char* merged = (char*)arena_alloc(&d->strings, n + 1);
+            memcpy(merged, c->label, c->label_len);
+            memcpy(merged + c->label_len, only->label, only->label_len);
+            merged[n] = '\0';
+            only->label = merged;
+            only->label_len = n;
+            free(c->child);
+            parent->child[pos] = only;
+        }
+        break;
+    }
+    return 1;
+}
+
+/*
+    ===== 사전순 순회 =====
+    buf에 루트부터의 label을 이어 붙여 단어를 복원
+*/
+void visit_words(RadixNode* p, char* buf, int len, int* limit) {
+    if (*limit == 0) return;
+
+    if (p->meaning) {
+        printf("%.*s : %s\n", len, buf, p->meaning);
+        if (*limit > 0) (*limit)--;
+    }
+    for (int i = 0; i < p->child_count && *limit != 0; i++) {
+        RadixNode* c = p->child[i];
+        if (len + c->label_len >= MAX_LINE_SIZE) continue;
+        memcpy(buf + len, c->label, c->label_len);
+        visit_words(c, buf, len + c->label_len, limit);
+    }
+}
+
+void dic_display(Dictionary* d) {
+    char buf[MAX_LINE_SIZE];
+    int limit = -1;     // 제한 없음
+    visit_words(&d->root, buf, 0, &limit);
+}
+
+/*
+    ===== dic_prefix =====
+    prefix로 시작하는 단어를 사전순으로 최대 limit개 출력 (limit < 0 이면 전부)
+    - 접두사 노드까지 O(|prefix|), 이후 결과 개수에 비례
+*/
+void dic_prefix(Dictionary* d, const char* prefix, int limit) {
+    char buf[MAX_LINE_SIZE];
+    int rest, len = (int)strlen(prefix);
+    RadixNode* p = descend(d, prefix, 0, &rest);
+
+    if (!p || len + rest >= MAX_LINE_SIZE) return;
+
+    // prefix가 간선 중간에서 끝났다면 그 간선의 나머지 글자까지 붙여서 시작
+    memcpy(buf, prefix, len);
+    memcpy(buf + len, p->label + p->label_len - rest, rest);
+    visit_words(p, buf, len + rest, &limit);
+}
+
+void free_nodes(RadixNode* p) {
+    for (int i = 0; i < p->child_count; i++)
+        free_nodes(p->child[i]);
+    free(p->child);
+}
+
+void dic_free(Dictionary* d) {
+    free_nodes(&d->root);
+    arena_free(&d->strings);
+    arena_free(&d->nodes);
+    dic_init(d);
+}
+
+/*
+    ===== dic_load =====
+    "단어<TAB>뜻" 형식의 파일을 한 줄씩 읽어 삽입
+*/
+int dic_load(Dictionary* d, const char* path) {
+    char line[MAX_LINE_SIZE];
+    FILE* fp = fopen(path, "r");
+    int count = 0;
+
+    if (!fp) return -1;
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char* tab = strchr(line, '\t');
+        if (!tab || tab == line) continue;
+        *tab = '\0';
+        dic_insert(d, line, tab + 1);
+        count++;
+    }
+    fclose(fp);
+    return count;
+}
+
+/* 줄 단위 입력 (gets 대체, 개행 제거) */
+int read_line(const char* prompt, char* buf, int size) {
+    printf("%s", prompt);
+    if (!fgets(buf, size, stdin)) return 0;
+    buf[strcspn(buf, "\r\n")] = '\0';
+    return 1;
+}
+
+void help() {
+    printf("\n**** i: 입력, d: 삭제, s: 탐색, f: 접두사 탐색, p: 출력, l: 파일 읽기, m: 메모리, q: 종료 ****: ");
+}
+
+int main(void) {
+    Dictionary dic;
+    char command[MAX_LINE_SIZE], word[MAX_LINE_SIZE], meaning[MAX_LINE_SIZE];
+    const char* found;
+
+    dic_init(&dic);
+
+    do {
+        help();
+        if (!fgets(command, sizeof(command), stdin)) break;
+
+        switch (command[0]) {
+        case 'i':
+            if (read_line("단어:", word, sizeof(word)) && word[0] &&
+                read_line("의미:", meaning, sizeof(meaning)))
+                dic_insert(&dic, word, meaning);
+            break;
+        case 'd':
+            if (read_line("단어:", word, sizeof(word)) && !dic_delete(&dic, word))
+                printf("없는 단어입니다.\n");
+            break;
+        case 's':
+            if (read_line("단어:", word, sizeof(word))) {
+                found = dic_search(&dic, word);
+                if (found) printf("의미:%s\n", found);
+                else printf("없는 단어입니다.\n");
+            }
+            break;
+        case 'f':
+            if (read_line("접두사:", word, sizeof(word)))
+                dic_prefix(&dic, word, 20);
+            break;
+        case 'p':
+            dic_display(&dic);
+            break;
+        case 'l':
+            if (read_line("파일:", word, sizeof(word))) {
+                int n = dic_load(&dic, word);
+                if (n < 0) printf("파일을 열 수 없습니다.\n");
+                else printf("%d개 읽음\n", n);
+            }
+            break;
+        case 'm':
+            printf("단어 수: %d, 문자열 %zu바이트, 노드 %zu바이트\n",
+                   dic.word_count, dic.strings.total, dic.nodes.total);
+            break;
+        }
+    } while (command[0] != 'q');
+
+    dic_free(&dic);
+    return 0;
+}
@@ -4,13 +4,34 @@
 /*
     이진 탐색 트리 노드 구조체
     data 필드는 BST에서 key 값으로 사용된다.
+    size 필드는 자신을 루트로 하는 서브트리의 "살아 있는" 노드 수 (rank/select용)
+    deleted 필드는 지연 삭제(lazy_delete)로 묘비(tombstone) 표시된 노드
 */
 typedef struct node {
     int data;                   // 노드의 키 값
+    int size;                   // 서브트리의 살아 있는 노드 수 (자기 자신 포함)
+    int deleted;                // 1이면 묘비: 구조는 유지하지만 검색에서는 없는 키
     struct node *left_child;    // 왼쪽 자식 노드
     struct node *right_child;   // 오른쪽 자식 노드
 } node;
 
+/*
+    지연 삭제 관련 설정
+    - tombstone_count : 트리에 남아 있는 묘비 노드 수
+    - 묘비 수가 COMPACT_MIN 이상이고 살아 있는 노드 수 이상이 되면
+      compact로 한 번에 정리 + 균형 재구성
+    (이 파일은 트리 하나만 다루므로 전역 카운터 하나로 관리)
+*/
+#define COMPACT_MIN 8
+int tombstone_count = 0;
+
+/* =====================================================
+   서브트리 크기 반환 (NULL이면 0)
+   ===================================================== */
+int node_size(node *ptr) {
+    return ptr ? ptr->size : 0;
+}
+
 /* =====================================================
    탐색 연산 (재귀 방식)
    key를 포함한 노드의 포인터를 반환
@@ -19,8 +40,8 @@ typedef struct node {
 node *search(node *root, int key) {
     if (!root) return NULL; // 트리가 비어있으면 NULL 반환
 
-    if (key == root->data)  // 키가 존재하면 노드 반환
-        return root;
+    if (key == root->data)  // 키가 존재하면 노드 반환 (묘비면 없는 키)
+        return root->deleted ? NULL : root;
 
     if (key < root->data)   // 키가 작으면 왼쪽 서브트리 탐색
         return search(root->left_child, key);
@@ -33,8 +54,8 @@ node *search(node *root, int key) {
    ===================================================== */
 node *iterSearch(node *tree, int key) {
     while (tree != NULL) {  // 트리가 비어있지 않으면 반복
-        if (key == tree->data)  // 키가 존재하면 노드 반환
-            return tree;
+        if (key == tree->data)  // 키가 존재하면 노드 반환 (묘비면 없는 키)
+            return tree->deleted ? NULL : tree;
 
         if (key < tree->data)   // 키가 작으면 왼쪽 서브트리로 이동
             tree = tree->left_child;
@@ -68,18 +89,44 @@ node *modified_search(node *root, int key) {
 /* =====================================================
    삽입 연산
    새로운 키 값을 BST에 삽입
+   같은 키의 묘비 노드가 있으면 새로 만들지 않고 되살린다.
    ===================================================== */
 void insert_node(node **root, int num) {    // 트리의 값을 바꿀때는 이중 포인터 사용
     node *parent, *ptr;
 
     parent = modified_search(*root, num);
 
+    /* 중복 키: 묘비라면 되살리고 경로상의 크기 1 증가 */
+    if (!parent && *root) {
+        ptr = *root;
+        while (ptr->data != num)
+            ptr = (num < ptr->data) ? ptr->left_child : ptr->right_child;
+        if (!ptr->deleted) return;
+
+        ptr->deleted = 0;
+        tombstone_count--;
+        for (node *p = *root; p != NULL; ) {
+            p->size++;
+            if (p == ptr) break;
+            p = (num < p->data) ? p->left_child : p->right_child;
+        }
+        return;
+    }
+
     /* 중복 키가 아니거나 트리가 비어 있는 경우만 삽입 */
     if (parent || !(*root)) {   //
         ptr = (node *)malloc(sizeof(node));
         ptr->data = num;
+        ptr->size = 1;
+        ptr->deleted = 0;
         ptr->left_child = ptr->right_child = NULL;
 
+        /* 루트부터 부모까지 경로상의 서브트리 크기 1 증가 */
+        for (node *p = *root; p != NULL; ) {
+            p->size++;
+            p = (num < p->data) ? p->left_child : p->right_child;
+        }
+
         if (*root) {
             if (num < parent->data)
                 parent->left_child = ptr;
@@ -92,26 +139,18 @@ void insert_node(node **root, int num) {    // 트리의 값을 바꿀때는 이
 }
 
 /* =====================================================
-   자식 노드가 2개일 때 사용할
-   오른쪽 서브트리의 최소값 노드 반환
-   ===================================================== */
-node *min_value_node(node *ptr) {
-    node *current = ptr;
-    while (current && current->left_child != NULL)
-        current = current->left_child;
-    return current;
-}
-
-/* =====================================================
-   삭제 연산
+   삭제 연산 (즉시 삭제)
    - 리프 노드
    - 자식 노드 1개
    - 자식 노드 2개
-   모든 경우를 처리
+   모든 경우를 처리 (묘비 노드도 물리적으로 제거)
    ===================================================== */
 node *delete_node(node *root, int key) {
     if (root == NULL) return root;
 
+    if (key == root->data && root->deleted)
+        tombstone_count--;  // 묘비 노드를 직접 지우는 경우
+
     if (key < root->data)
         root->left_child = delete_node(root->left_child, key);
 
@@ -137,21 +176,263 @@ node *delete_node(node *root, int key) {
             return temp;
         }
 
-        /* Case 3: 자식 노드 2개 */
-        node *temp = min_value_node(root->right_child);
-        root->data = temp->data;
-        root->right_child = delete_node(root->right_child, temp->data);
+        /* Case 3: 자식 노드 2개
+           오른쪽 서브트리의 최소 노드(후계자)를 한 번의 하강으로 찾아
+           그 자리에서 떼어낸 뒤 값을 옮긴다. (두 번째 재귀 삭제 없음) */
+        node **link = &root->right_child;
+        while ((*link)->left_child)
+            link = &(*link)->left_child;
+
+        node *succ = *link;
+        if (!succ->deleted) {   // 후계자가 빠지므로 경로상의 크기 1 감소
+            for (node *p = root->right_child; p != succ; p = p->left_child)
+                p->size--;
+        }
+        *link = succ->right_child;  // 후계자는 왼쪽 자식이 없음
+
+        root->data = succ->data;
+        root->deleted = succ->deleted;
+        free(succ);
     }
+    /* 자식 서브트리가 바뀌었을 수 있으므로 크기 재계산 */
+    root->size = !root->deleted + node_size(root->left_child) + node_size(root->right_child);
     return root;
 }
 
 /* =====================================================
-   중위 순회 (BST 정렬 결과 확인용)
+   rank : key보다 작은 (살아 있는) 키의 개수 (0부터 시작하는 순위)
+   key가 트리에 있으면 그 노드의 중위 순회 위치와 같다.
+   ===================================================== */
+int rank(node *root, int key) {
+    int r = 0;
+    while (root) {
+        if (key <= root->data) {
+            root = root->left_child;
+        } else {
+            // 현재 노드와 왼쪽 서브트리는 모두 key보다 작음
+            r += node_size(root->left_child) + !root->deleted;
+            root = root->right_child;
+        }
+    }
+    return r;
+}
+
+/* =====================================================
+   select : i번째(0부터) 작은 키를 가진 노드
+   범위를 벗어나면 NULL 반환
+   ===================================================== */
+node *select(node *root, int i) {
+    if (i < 0 || i >= node_size(root)) return NULL;
+
+    while (root) {
+        int left = node_size(root->left_child);
+        int self = !root->deleted;  // 묘비 노드는 순위에 포함되지 않음
+        if (i < left) {
+            root = root->left_child;
+        } else if (i < left + self) {
+            return root;
+        } else {
+            i -= left + self;  // 왼쪽 서브트리와 현재 노드를 건너뜀
+            root = root->right_child;
+        }
+    }
+    return NULL;
+}
+
+/* =====================================================
+   중위 순회 반복자 (재귀/출력 없음)
+   stack에는 "아직 방문하지 않은 조상" 노드가 쌓인다.
+   트리 높이만큼 자라므로 동적으로 확장한다.
+   ===================================================== */
+typedef struct bst_iterator {
+    node **stack;
+    int top;        // 스택에 들어있는 노드 수
+    int capacity;
+} bst_iterator;
+
+void iter_push(bst_iterator *it, node *ptr) {
+    if (it->top == it->capacity) {
+        it->capacity = it->capacity ? it->capacity * 2 : 16;
+        it->stack = (node **)realloc(it->stack, it->capacity * sizeof(node *));
+        if (!it->stack) {
+            fprintf(stderr, "메모리 할당 오류\n");
+            exit(1);
+        }
+    }
+    it->stack[it->top++] = ptr;
+}
+
+/* 가장 작은 키부터 시작하도록 초기화 */
+void iter_init(bst_iterator *it, node *root) {
+    it->stack = NULL;
+    it->top = it->capacity = 0;
+    for (; root; root = root->left_child)
+        iter_push(it, root);
+}
+
+/* lo 이상인 첫 키부터 시작하도록 초기화, O(h) */
+void iter_seek(bst_iterator *it, node *root, int lo) {
+    it->top = 0;
+    while (root) {
+        if (root->data >= lo) {     // root는 이후에 방문해야 하므로 스택에 보관
+            iter_push(it, root);
+            root = root->left_child;
+        } else {                    // root와 왼쪽 서브트리는 범위 밖
+            root = root->right_child;
+        }
+    }
+}
+
+/* 다음 (살아 있는) 노드 반환, 끝이면 NULL (분할 상환 O(1)) */
+node *iter_next(bst_iterator *it) {
+    while (it->top > 0) {
+        node *cur = it->stack[--it->top];
+        for (node *p = cur->right_child; p; p = p->left_child)
+            iter_push(it, p);
+        if (!cur->deleted) return cur;  // 묘비는 건너뜀
+    }
+    return NULL;
+}
+
+void iter_free(bst_iterator *it) {
+    free(it->stack);
+    it->stack = NULL;
+    it->top = it->capacity = 0;
+}
+
+/* =====================================================
+   rank_upper : key 이하인 (살아 있는) 키의 개수
+   rank 와 같은 하강이지만 key와 같은 노드도 센다.
+   ===================================================== */
+int rank_upper(node *root, int key) {
+    int r = 0;
+    while (root) {
+        if (key < root->data) {
+            root = root->left_child;
+        } else {
+            r += node_size(root->left_child) + !root->deleted;
+            root = root->right_child;
+        }
+    }
+    return r;
+}
+
+/* =====================================================
+   lower_bound : key 이상인 가장 작은 노드
+   upper_bound : key 초과인 가장 작은 노드
+   없으면 NULL 반환, O(h)
+   - 순위를 구한 뒤 그 순위의 노드를 select로 찾는다.
+     두 하강 모두 살아 있는 노드 수(size)만 보므로 묘비를 하나씩 건너뛰지 않는다.
+   ===================================================== */
+node *lower_bound(node *root, int key) {
+    return select(root, rank(root, key));
+}
+
+node *upper_bound(node *root, int key) {
+    return select(root, rank_upper(root, key));
+}
+
+/* =====================================================
+   [lo, hi] 범위에 속한 키의 개수, O(h)
+   ===================================================== */
+int range_count(node *root, int lo, int hi) {
+    if (lo > hi) return 0;
+    return rank_upper(root, hi) - rank(root, lo);
+}
+
+/* =====================================================
+   range : [lo, hi] 범위의 노드를 오름차순으로 visit에 전달
+   O(log n + k)  (k = 범위에 속한 노드 수, 균형 트리 기준)
+   ===================================================== */
+void range(node *root, int lo, int hi, void (*visit)(node *, void *), void *arg) {
+    bst_iterator it;
+    node *p;
+
+    iter_init(&it, NULL);
+    iter_seek(&it, root, lo);
+    while ((p = iter_next(&it)) != NULL && p->data <= hi)
+        visit(p, arg);
+    iter_free(&it);
+}
+
+/* range 출력용 visit 함수 */
+void print_visit(node *ptr, void *arg) {
+    (void)arg;
+    printf("%d ", ptr->data);
+}
+
+/* =====================================================
+   compact : 묘비 정리 + 균형 재구성
+   - 중위 순회 한 번으로 살아 있는 노드는 배열에 모으고 묘비 노드는 free
+   - 모은 노드(이미 정렬됨)를 가운데 기준으로 다시 연결하여 균형 트리 생성
+   - 노드를 새로 할당하지 않고 재사용, 새 루트 반환
+   ===================================================== */
+node *build_balanced(node **sorted, int lo, int hi) {
+    if (lo >= hi) return NULL;
+    int mid = lo + (hi - lo) / 2;
+    node *root = sorted[mid];
+    root->left_child = build_balanced(sorted, lo, mid);
+    root->right_child = build_balanced(sorted, mid + 1, hi);
+    root->size = hi - lo;
+    return root;
+}
+
+node *compact(node *root) {
+    int live = node_size(root), n = 0;
+    node **sorted = (node **)malloc(sizeof(node *) * (live + 1));
+    bst_iterator it;
+    node *cur = root;
+
+    // 묘비까지 포함한 중위 순회 (iter_next는 묘비를 건너뛰므로 직접 순회)
+    iter_init(&it, NULL);
+    while (cur || it.top) {
+        for (; cur; cur = cur->left_child)
+            iter_push(&it, cur);
+        cur = it.stack[--it.top];
+        node *right = cur->right_child;
+        if (cur->deleted) free(cur);
+        else sorted[n++] = cur;
+        cur = right;
+    }
+    iter_free(&it);
+
+    root = build_balanced(sorted, 0, n);
+    free(sorted);
+    tombstone_count = 0;
+    return root;
+}
+
+/* =====================================================
+   지연 삭제 (tombstone)
+   - 노드를 떼어내지 않고 deleted 표시만 한 뒤 경로상의 크기 1 감소
+   - 구조 변경/free 가 없으므로 삭제 비용은 탐색 한 번 수준
+   - 묘비가 쌓이면 compact로 한꺼번에 정리
+   반환: 삭제했으면 1, 키가 없으면 0
+   ===================================================== */
+int lazy_delete(node **root, int key) {
+    node *target = iterSearch(*root, key);
+    if (!target) return 0;
+
+    target->deleted = 1;
+    tombstone_count++;
+    for (node *p = *root; ; p = (key < p->data) ? p->left_child : p->right_child) {
+        p->size--;
+        if (p == target) break;
+    }
+
+    if (tombstone_count >= COMPACT_MIN && tombstone_count >= node_size(*root))
+        *root = compact(*root);
+    return 1;
+}
+
+/* =====================================================
+   중위 순회 (BST 정렬 결과 확인용, 묘비는 출력하지 않음)
    ===================================================== */
 void inorder(node *root) {
     if (root) {
         inorder(root->left_child);
-        printf("%d ", root->data);
+        if (!root->deleted)
+            printf("%d ", root->data);
         inorder(root->right_child);
     }
 }
@@ -202,6 +483,57 @@ int main() {
     printf("자식 노드 2개인 50 삭제 후: ");
     root = delete_node(root, 50);
     inorder(root);
+    printf("\n\n");
+
+    printf("=== 범위 / 순위 연산 ===\n");
+    insert_node(&root, 65);
+    insert_node(&root, 75);
+    insert_node(&root, 35);
+    printf("현재 트리: ");
+    inorder(root);
+    printf("\n");
+
+    printf("range(35, 70): ");
+    range(root, 35, 70, print_visit, NULL);
+    printf("(개수 %d)\n", range_count(root, 35, 70));
+
+    node *lb = lower_bound(root, 62), *ub = upper_bound(root, 65);
+    printf("lower_bound(62) = %d, upper_bound(65) = %d\n",
+           lb ? lb->data : -1, ub ? ub->data : -1);
+
+    printf("rank(65) = %d\n", rank(root, 65));
+    for (int i = 0; i < node_size(root); i++)
+        printf("select(%d) = %d\n", i, select(root, i)->data);
+
+    printf("반복자 순회: ");
+    bst_iterator it;
+    node *p;
+    iter_init(&it, root);
+    while ((p = iter_next(&it)) != NULL)
+        printf("%d ", p->data);
+    iter_free(&it);
+    printf("\n\n");
+
+    printf("=== 지연 삭제 (tombstone) ===\n");
+    for (int k = 1; k <= 20; k++)
+        insert_node(&root, k);
+    for (int k = 1; k <= 20; k += 2) {
+        lazy_delete(&root, k);
+        printf("%d 지연 삭제 -> 묘비 %d개, 살아 있는 노드 %d개\n",
+               k, tombstone_count, node_size(root));
+    }
+    printf("중위 순회 결과: ");
+    inorder(root);
+    printf("\n");
+    printf("rank(10) = %d, select(0) = %d\n", rank(root, 10), select(root, 0)->data);
+
+    lazy_delete(&root, 70);
+    insert_node(&root, 70);     // 묘비 되살리기
+    printf("70 삭제 후 재삽입: %s\n", search(root, 70) ? "존재" : "없음");
+
+    root = compact(root);
+    printf("compact 후 중위 순회: ");
+    inorder(root);
     printf("\n");
 
     return 0;